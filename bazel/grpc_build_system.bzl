@@ -29,7 +29,7 @@ load("@upb//bazel:upb_proto_library.bzl", "upb_proto_library")
 load("@build_bazel_rules_apple//apple:ios.bzl", "ios_unit_test")
 
 # The set of pollers to test against if a test exercises polling
-POLLERS = ["epollex", "epoll1", "poll"]
+POLLERS = ["epollex", "epoll1", "poll", "io_uring"]
 
 def if_not_windows(a):
     return select({
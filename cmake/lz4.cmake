@@ -0,0 +1,27 @@
+# Copyright 2020 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# lz4 is optional: only the GRPC_COMPRESS_LZ4 message compression algorithm
+# uses it, and that algorithm is only compiled in when GRPC_HAVE_LZ4 is
+# defined. "none" (the default) builds without it; "package" uses a
+# pre-installed lz4 and defines GRPC_HAVE_LZ4.
+
+if(gRPC_LZ4_PROVIDER STREQUAL "package")
+  find_package(lz4 REQUIRED)
+  set(_gRPC_LZ4_LIBRARIES lz4::lz4)
+  set(_gRPC_LZ4_DEFINES GRPC_HAVE_LZ4)
+  set(_gRPC_FIND_LZ4 "if(NOT lz4_FOUND)\n  find_package(lz4)\nendif()")
+elseif(NOT gRPC_LZ4_PROVIDER STREQUAL "none")
+  message(FATAL_ERROR "gRPC_LZ4_PROVIDER must be \"none\" or \"package\"")
+endif()
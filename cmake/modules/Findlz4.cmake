@@ -0,0 +1,30 @@
+# Copyright 2020 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+include(FindPackageHandleStandardArgs)
+
+find_path(lz4_INCLUDE_DIR NAMES lz4.h)
+find_library(lz4_LIBRARY NAMES lz4)
+
+find_package_handle_standard_args(lz4
+  REQUIRED_VARS lz4_INCLUDE_DIR lz4_LIBRARY
+  )
+
+if(lz4_FOUND AND NOT TARGET lz4::lz4)
+  add_library(lz4::lz4 UNKNOWN IMPORTED)
+  set_target_properties(lz4::lz4 PROPERTIES
+    IMPORTED_LOCATION "${lz4_LIBRARY}"
+    INTERFACE_INCLUDE_DIRECTORIES "${lz4_INCLUDE_DIR}"
+    )
+endif()
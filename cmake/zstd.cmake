@@ -0,0 +1,27 @@
+# Copyright 2020 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# zstd is optional: only the GRPC_COMPRESS_ZSTD message compression algorithm
+# uses it, and that algorithm is only compiled in when GRPC_HAVE_ZSTD is
+# defined. "none" (the default) builds without it; "package" uses a
+# pre-installed zstd and defines GRPC_HAVE_ZSTD.
+
+if(gRPC_ZSTD_PROVIDER STREQUAL "package")
+  find_package(zstd REQUIRED)
+  set(_gRPC_ZSTD_LIBRARIES zstd::zstd)
+  set(_gRPC_ZSTD_DEFINES GRPC_HAVE_ZSTD)
+  set(_gRPC_FIND_ZSTD "if(NOT zstd_FOUND)\n  find_package(zstd)\nendif()")
+elseif(NOT gRPC_ZSTD_PROVIDER STREQUAL "none")
+  message(FATAL_ERROR "gRPC_ZSTD_PROVIDER must be \"none\" or \"package\"")
+endif()
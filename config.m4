@@ -507,6 +507,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/iomgr/timer_heap.cc \
     src/core/lib/iomgr/timer_manager.cc \
     src/core/lib/iomgr/timer_uv.cc \
+    src/core/lib/iomgr/timer_wheel.cc \
     src/core/lib/iomgr/udp_server.cc \
     src/core/lib/iomgr/unix_sockets_posix.cc \
     src/core/lib/iomgr/unix_sockets_posix_noop.cc \
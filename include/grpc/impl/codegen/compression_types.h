@@ -47,9 +47,20 @@ extern "C" {
  * GRPC_COMPRESS_NONE, the next bit to GRPC_COMPRESS_DEFLATE, etc.
  * Unset bits disable support for the algorithm. By default all algorithms are
  * supported. It's not possible to disable GRPC_COMPRESS_NONE (the attempt will
- * be ignored). */
+ * be ignored). Algorithms that were not compiled in (see
+ * \a GRPC_COMPRESS_ZSTD and \a GRPC_COMPRESS_LZ4) are never advertised to
+ * peers, regardless of this bitset. */
 #define GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET \
   "grpc.compression_enabled_algorithms_bitset"
+/** Path to a preset dictionary that deflate and zstd compress messages
+ * against. Its value is a string. Peers advertise the dictionary they hold in
+ * initial metadata and only compress against it once the other side has
+ * advertised the same one: servers from the client's request, clients from an
+ * earlier response on the same connection. Both ends of a channel must be
+ * configured with the same file for it to take effect. Small, repetitive
+ * messages benefit most. */
+#define GRPC_COMPRESSION_CHANNEL_DICTIONARY_FILE \
+  "grpc.compression_dictionary_file"
 /** \} */
 
 /** The various compression algorithms supported by gRPC (not sorted by
@@ -60,6 +71,12 @@ typedef enum {
   GRPC_COMPRESS_GZIP,
   /* EXPERIMENTAL: Stream compression is currently experimental. */
   GRPC_COMPRESS_STREAM_GZIP,
+  /* Only available when gRPC is built with GRPC_HAVE_ZSTD and linked against
+   * libzstd. */
+  GRPC_COMPRESS_ZSTD,
+  /* Only available when gRPC is built with GRPC_HAVE_LZ4 and linked against
+   * liblz4. */
+  GRPC_COMPRESS_LZ4,
   /* TODO(ctiller): snappy */
   GRPC_COMPRESS_ALGORITHMS_COUNT
 } grpc_compression_algorithm;
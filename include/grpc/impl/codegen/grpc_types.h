@@ -232,6 +232,17 @@ typedef struct {
 /** How much data are we willing to queue up per stream if
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** How long, in microseconds, an idle transport holds back a write started by
+    an RPC so that frames from other streams can join it. The delay is rounded
+    up to the timer granularity of one millisecond. Pings, resets, settings and
+    flow control updates are never held back. Defaults to 0 (disabled). */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US \
+  "grpc.http2.write_coalescing_window_us"
+/** Once this many bytes of messages are queued, a write held back by
+    GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US is flushed without waiting for
+    the rest of the window. Int valued, bytes; defaults to 64KiB. */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_BYTES \
+  "grpc.http2.write_coalescing_max_bytes"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -297,8 +308,25 @@ typedef struct {
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable) */
 #define GRPC_ARG_RESOURCE_QUOTA "grpc.resource_quota"
+/** The maximum amount of memory, in bytes, a channel keeps in arenas of
+ * finished calls for reuse by new calls. If GRPC_ARG_RESOURCE_QUOTA is set,
+ * the memory is given back when the quota comes under pressure, but it is not
+ * charged to the quota. Defaults to 0, which disables arena reuse. */
+#define GRPC_ARG_CALL_ARENA_POOL_SIZE "grpc.call_arena_pool_size"
 /** If non-zero, expand wildcard addresses to a list of local addresses. */
 #define GRPC_ARG_EXPAND_WILDCARD_ADDRS "grpc.expand_wildcard_addrs"
+/** If non-zero, and SO_REUSEPORT is in use, a server binds one listener per
+    pollset (i.e. per server completion queue) and keeps every connection on
+    the pollset whose listener accepted it, instead of spreading connections
+    over all pollsets. Running one completion queue per core then shards the
+    server per core. Defaults to 0. */
+#define GRPC_ARG_TCP_LISTENER_AFFINITY "grpc.experimental.tcp_listener_affinity"
+/** If non-zero, together with GRPC_ARG_TCP_LISTENER_AFFINITY, set
+    SO_INCOMING_CPU on the n-th per-pollset listener to cpu n so that the
+    kernel hands a connection to the listener of the cpu that received it.
+    Defaults to 0. */
+#define GRPC_ARG_TCP_LISTENER_INCOMING_CPU \
+  "grpc.experimental.tcp_listener_incoming_cpu"
 /** Service config data in JSON form.
     This value will be ignored if the name resolver returns a service config. */
 #define GRPC_ARG_SERVICE_CONFIG "grpc.service_config"
@@ -350,6 +378,15 @@ typedef struct {
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map received pages into slices with
+   TCP_ZEROCOPY_RECEIVE instead of copying them. By default, it is disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy receive threshold: only zerocopy reads of >= this many
+   bytes; smaller reads are copied. By default, this is set to 64KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_recv_bytes_threshold"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -413,6 +450,18 @@ typedef struct {
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
+/** Maximum number of connections a subchannel opens to its address. Above 1,
+ * the subchannel opens another connection whenever every open one carries
+ * GRPC_ARG_SUBCHANNEL_STREAMS_PER_CONNECTION calls, spreads new calls across
+ * them, and closes the extra ones again once they go idle. Defaults to 1. */
+#define GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS \
+  "grpc.experimental.subchannel_max_connections"
+/** Number of concurrent calls a subchannel connection is considered able to
+ * carry. The MAX_CONCURRENT_STREAMS setting received from the server caps it.
+ * Only used when GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS is above 1. Defaults to
+ * 100. */
+#define GRPC_ARG_SUBCHANNEL_STREAMS_PER_CONNECTION \
+  "grpc.experimental.subchannel_streams_per_connection"
 /** gRPC Objective-C channel pooling domain string. */
 #define GRPC_ARG_CHANNEL_POOL_DOMAIN "grpc.channel_pooling_domain"
 /** gRPC Objective-C channel pooling id. */
@@ -58,9 +58,9 @@ class MessageHolder : public RpcAllocatorState {
   ResponseT* response_;
 };
 
-// A custom allocator can be set via the generated code to a callback unary
-// method, such as SetMessageAllocatorFor_Echo(custom_allocator). The allocator
-// needs to be alive for the lifetime of the server.
+// A custom allocator can be set via the generated code to a sync or callback
+// unary method, such as SetMessageAllocatorFor_Echo(custom_allocator). The
+// allocator needs to be alive for the lifetime of the server.
 // Implementations need to be thread-safe.
 template <typename RequestT, typename ResponseT>
 class MessageAllocator {
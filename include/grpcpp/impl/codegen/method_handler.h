@@ -21,6 +21,7 @@
 
 #include <grpcpp/impl/codegen/byte_buffer.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
+#include <grpcpp/impl/codegen/message_allocator.h>
 #include <grpcpp/impl/codegen/rpc_service_method.h>
 #include <grpcpp/impl/codegen/sync_stream.h>
 
@@ -104,27 +105,73 @@ class RpcMethodHandler : public ::grpc::internal::MethodHandler {
       ServiceType* service)
       : func_(func), service_(service) {}
 
+  void SetMessageAllocator(
+      ::grpc::experimental::MessageAllocator<RequestType, ResponseType>*
+          allocator) {
+    allocator_ = allocator;
+  }
+
   void RunHandler(const HandlerParameter& param) final {
-    ResponseType rsp;
+    auto* allocator_state = static_cast<
+        ::grpc::experimental::MessageHolder<RequestType, ResponseType>*>(
+        param.internal_data);
+    if (allocator_state == nullptr) {
+      ResponseType rsp;
+      ::grpc::Status status = param.status;
+      if (status.ok()) {
+        status = CatchingFunctionHandler([this, &param, &rsp] {
+          return func_(
+              service_,
+              static_cast<::grpc::ServerContext*>(param.server_context),
+              static_cast<RequestType*>(param.request), &rsp);
+        });
+        static_cast<RequestType*>(param.request)->~RequestType();
+      }
+      UnaryRunHandlerHelper(param, static_cast<BaseResponseType*>(&rsp),
+                            status);
+      return;
+    }
+    // The request and response are owned by the allocator; the application
+    // may free the request early through the RpcAllocatorState.
     ::grpc::Status status = param.status;
     if (status.ok()) {
-      status = CatchingFunctionHandler([this, &param, &rsp] {
+      static_cast<::grpc::ServerContext*>(param.server_context)
+          ->set_message_allocator_state(allocator_state);
+      status = CatchingFunctionHandler([this, &param, allocator_state] {
         return func_(service_,
                      static_cast<::grpc::ServerContext*>(param.server_context),
-                     static_cast<RequestType*>(param.request), &rsp);
+                     allocator_state->request(), allocator_state->response());
       });
-      static_cast<RequestType*>(param.request)->~RequestType();
     }
-    UnaryRunHandlerHelper(param, static_cast<BaseResponseType*>(&rsp), status);
+    UnaryRunHandlerHelper(
+        param, static_cast<BaseResponseType*>(allocator_state->response()),
+        status);
+    allocator_state->Release();
   }
 
   void* Deserialize(grpc_call* call, grpc_byte_buffer* req,
-                    ::grpc::Status* status, void** /*handler_data*/) final {
-    auto* request =
-        new (::grpc::g_core_codegen_interface->grpc_call_arena_alloc(
-            call, sizeof(RequestType))) RequestType;
-    return UnaryDeserializeHelper(req, status,
-                                  static_cast<BaseRequestType*>(request));
+                    ::grpc::Status* status, void** handler_data) final {
+    if (allocator_ == nullptr || handler_data == nullptr) {
+      auto* request =
+          new (::grpc::g_core_codegen_interface->grpc_call_arena_alloc(
+              call, sizeof(RequestType))) RequestType;
+      return UnaryDeserializeHelper(req, status,
+                                    static_cast<BaseRequestType*>(request));
+    }
+    ::grpc::ByteBuffer buf;
+    buf.set_buffer(req);
+    auto* allocator_state = allocator_->AllocateMessages();
+    RequestType* request = allocator_state->request();
+    *status = ::grpc::SerializationTraits<BaseRequestType>::Deserialize(
+        &buf, static_cast<BaseRequestType*>(request));
+    buf.Release();
+    if (status->ok()) {
+      *handler_data = allocator_state;
+      return request;
+    }
+    // Clean up on deserialization failure.
+    allocator_state->Release();
+    return nullptr;
   }
 
  private:
@@ -134,6 +181,10 @@ class RpcMethodHandler : public ::grpc::internal::MethodHandler {
       func_;
   // The class the above handler function lives in.
   ServiceType* service_;
+  // Optional allocator for the request and response messages; when null they
+  // live in the call arena and on the stack respectively.
+  ::grpc::experimental::MessageAllocator<RequestType, ResponseType>*
+      allocator_ = nullptr;
 };
 
 /// A wrapper class of an application provided client streaming handler.
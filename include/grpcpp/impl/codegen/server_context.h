@@ -298,7 +298,7 @@ class ServerContextBase {
 
   /// NOTE: This is an API for advanced users who need custom allocators.
   /// Get and maybe mutate the allocator state associated with the current RPC.
-  /// Currently only applicable for callback unary RPC methods.
+  /// Currently only applicable for sync and callback unary RPC methods.
   /// WARNING: This is experimental API and could be changed or removed.
   ::grpc::experimental::RpcAllocatorState* GetRpcAllocatorState() {
     return message_allocator_state_;
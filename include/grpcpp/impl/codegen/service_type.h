@@ -216,6 +216,19 @@ class Service {
     methods_[idx]->SetMethodType(internal::RpcMethod::BIDI_STREAMING);
   }
 
+  // Returns the handler of a unary method that is still served through the
+  // sync API, i.e. an RpcMethodHandler.
+  internal::MethodHandler* GetSyncUnaryHandler(int index) {
+    size_t idx = static_cast<size_t>(index);
+    GPR_CODEGEN_ASSERT(
+        methods_[idx] && methods_[idx]->handler() &&
+        methods_[idx]->api_type() ==
+            internal::RpcServiceMethod::ApiType::SYNC &&
+        methods_[idx]->method_type() == internal::RpcMethod::NORMAL_RPC &&
+        "Cannot set a message allocator on a method that is not sync unary");
+    return methods_[idx]->handler();
+  }
+
 #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
   void MarkMethodCallback(int index, internal::MethodHandler* handler) {
     MarkMethodCallbackInternal(index, handler);
@@ -121,6 +121,24 @@ class Server : public ServerInterface, private GrpcLibraryCodegen {
             std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
             interceptor_creators);
 
+    /// Statistics of the handler thread pools of a sync server built with
+    /// ServerBuilder::HANDLER_THREADS, summed over its completion queues
+    /// (the maximums are taken over them). All zero otherwise.
+    struct HandlerPoolStats {
+      /// Number of calls currently waiting for a handler thread, and the
+      /// largest number ever waiting on a completion queue.
+      size_t queue_depth = 0;
+      size_t max_queue_depth = 0;
+      /// Number of calls run by a handler thread, and the number failed with
+      /// RESOURCE_EXHAUSTED because the queue was full.
+      int64_t num_dispatched = 0;
+      int64_t num_rejected = 0;
+      /// Total and largest time that dispatched calls spent in the queue.
+      int64_t total_wait_usec = 0;
+      int64_t max_wait_usec = 0;
+    };
+    HandlerPoolStats GetHandlerPoolStats();
+
    private:
     Server* server_;
   };
@@ -173,10 +191,18 @@ class Server : public ServerInterface, private GrpcLibraryCodegen {
   ///
   /// \param sync_cq_timeout_msec The timeout to use when calling AsyncNext() on
   /// server completion queues passed via sync_server_cqs param.
+  ///
+  /// \param num_handler_threads The number of pre-spawned threads per server
+  /// completion queue that run sync handlers handed off by the polling
+  /// threads. Zero means polling threads run the handlers themselves.
+  ///
+  /// \param handler_queue_size The maximum number of calls per server
+  /// completion queue waiting for a handler thread.
   Server(ChannelArguments* args,
          std::shared_ptr<std::vector<std::unique_ptr<ServerCompletionQueue>>>
              sync_server_cqs,
          int min_pollers, int max_pollers, int sync_cq_timeout_msec,
+         int num_handler_threads, int handler_queue_size,
          std::vector<std::shared_ptr<internal::ExternalConnectionAcceptorImpl>>
              acceptors,
          grpc_server_config_fetcher* server_config_fetcher = nullptr,
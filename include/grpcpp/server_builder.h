@@ -230,10 +230,13 @@ class ServerBuilder {
 
   /// Options for synchronous servers.
   enum SyncServerOption {
-    NUM_CQS,         ///< Number of completion queues.
-    MIN_POLLERS,     ///< Minimum number of polling threads.
-    MAX_POLLERS,     ///< Maximum number of polling threads.
-    CQ_TIMEOUT_MSEC  ///< Completion queue timeout in milliseconds.
+    NUM_CQS,            ///< Number of completion queues.
+    MIN_POLLERS,        ///< Minimum number of polling threads.
+    MAX_POLLERS,        ///< Maximum number of polling threads.
+    CQ_TIMEOUT_MSEC,    ///< Completion queue timeout in milliseconds.
+    HANDLER_THREADS,    ///< Handler threads per CQ (0: pollers run handlers).
+    HANDLER_QUEUE_SIZE  ///< Max calls waiting for a handler thread per CQ
+                        ///< (at least 1).
   };
 
   /// Only useful if this is a Synchronous server.
@@ -362,7 +365,12 @@ class ServerBuilder {
 
   struct SyncServerSettings {
     SyncServerSettings()
-        : num_cqs(1), min_pollers(1), max_pollers(2), cq_timeout_msec(10000) {}
+        : num_cqs(1),
+          min_pollers(1),
+          max_pollers(2),
+          cq_timeout_msec(10000),
+          num_handler_threads(0),
+          handler_queue_size(1024) {}
 
     /// Number of server completion queues to create to listen to incoming RPCs.
     int num_cqs;
@@ -377,6 +385,14 @@ class ServerBuilder {
 
     /// The timeout for server completion queue's AsyncNext call.
     int cq_timeout_msec;
+
+    /// Number of handler threads per completion queue. Zero keeps the default
+    /// mode where every polling thread also runs the handlers.
+    int num_handler_threads;
+
+    /// Maximum number of calls waiting for a handler thread per completion
+    /// queue (used only if num_handler_threads is non-zero).
+    int handler_queue_size;
   };
 
   int max_receive_message_size_;
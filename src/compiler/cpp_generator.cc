@@ -816,6 +816,31 @@ void PrintHeaderServerMethodSync(grpc_generator::Printer* printer,
   printer->Print(method->GetTrailingComments("//").c_str());
 }
 
+// Lets a sync unary method take its request and response from a custom
+// MessageAllocator. Service::GetSyncUnaryHandler() asserts that the method
+// still has its sync handler, so the cast below is safe.
+void PrintHeaderServerMethodSyncAllocator(
+    grpc_generator::Printer* printer, const grpc_generator::Method* method,
+    std::map<std::string, std::string>* vars) {
+  if (!method->NoStreaming()) {
+    return;
+  }
+  (*vars)["Method"] = method->name();
+  (*vars)["Request"] = method->input_type_name();
+  (*vars)["Response"] = method->output_type_name();
+  printer->Print(*vars,
+                 "void SetMessageAllocatorFor_$Method$(\n"
+                 "    ::grpc::experimental::MessageAllocator< "
+                 "$Request$, $Response$>* allocator) {\n"
+                 "  static_cast<::grpc::internal::RpcMethodHandler< "
+                 "Service, $Request$, $Response$, "
+                 "::grpc::protobuf::MessageLite, "
+                 "::grpc::protobuf::MessageLite>*>(\n"
+                 "      ::grpc::Service::GetSyncUnaryHandler($Idx$))\n"
+                 "          ->SetMessageAllocator(allocator);\n"
+                 "}\n");
+}
+
 // Helper generator. Disables the sync API for Request and Response, then adds
 // in an async API for RealRequest and RealResponse types. This is to be used
 // to generate async and raw async APIs.
@@ -1596,6 +1621,11 @@ void PrintHeaderService(grpc_generator::Printer* printer,
   for (int i = 0; i < service->method_count(); ++i) {
     PrintHeaderServerMethodSync(printer, service->method(i).get(), vars);
   }
+  for (int i = 0; i < service->method_count(); ++i) {
+    (*vars)["Idx"] = as_string(i);
+    PrintHeaderServerMethodSyncAllocator(printer, service->method(i).get(),
+                                         vars);
+  }
   printer->Outdent();
   printer->Print("};\n");
 
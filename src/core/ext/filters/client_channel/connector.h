@@ -50,11 +50,15 @@ class SubchannelConnector : public InternallyRefCounted<SubchannelConnector> {
     const grpc_channel_args* channel_args = nullptr;
     // Channelz socket node of the connected transport, if any.
     RefCountedPtr<channelz::SocketNode> socket_node;
+    // Number of concurrent streams the peer allows on the transport, if
+    // known.
+    uint32_t max_concurrent_streams = UINT32_MAX;
 
     void Reset() {
       transport = nullptr;
       channel_args = nullptr;
       socket_node.reset();
+      max_concurrent_streams = UINT32_MAX;
     }
   };
 
@@ -19,9 +19,20 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <vector>
+
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/json/json.h"
+
 namespace grpc_core {
 extern const char* kRequestRingHashAttribute;
 
+// Helper Parsing method to parse ring hash policy configs; for example, ring
+// hash size validity.  Defaults are filled in for missing fields.
+void ParseRingHashLbConfig(const Json& json, size_t* min_ring_size,
+                           size_t* max_ring_size,
+                           std::vector<grpc_error*>* error_list);
+
 }  // namespace grpc_core
 
 #endif  // GRPC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_RING_HASH_RING_HASH_H
@@ -67,6 +67,9 @@
 #define GRPC_SUBCHANNEL_RECONNECT_MAX_BACKOFF_SECONDS 120
 #define GRPC_SUBCHANNEL_RECONNECT_JITTER 0.2
 
+// Connection scaling parameters.
+#define GRPC_SUBCHANNEL_DEFAULT_STREAMS_PER_CONNECTION 100
+
 // Conversion between subchannel call and call stack.
 #define SUBCHANNEL_CALL_TO_CALL_STACK(call) \
   (grpc_call_stack*)((char*)(call) +        \
@@ -84,18 +87,50 @@ DebugOnlyTraceFlag grpc_trace_subchannel_refcount(false, "subchannel_refcount");
 // ConnectedSubchannel
 //
 
+namespace {
+
+// A connection counts as saturated once it carries as many calls as the
+// channel args allow, or as the peer's MAX_CONCURRENT_STREAMS if that is
+// lower: further calls would only queue in the transport.
+intptr_t GetStreamsPerConnection(const grpc_channel_args* args,
+                                 uint32_t peer_max_concurrent_streams) {
+  intptr_t streams_per_connection = grpc_channel_args_find_integer(
+      args, GRPC_ARG_SUBCHANNEL_STREAMS_PER_CONNECTION,
+      {GRPC_SUBCHANNEL_DEFAULT_STREAMS_PER_CONNECTION, 1, INT_MAX});
+  if (peer_max_concurrent_streams <
+      static_cast<uint32_t>(streams_per_connection)) {
+    streams_per_connection =
+        std::max<intptr_t>(peer_max_concurrent_streams, 1);
+  }
+  return streams_per_connection;
+}
+
+}  // namespace
+
 ConnectedSubchannel::ConnectedSubchannel(
     grpc_channel_stack* channel_stack, const grpc_channel_args* args,
-    RefCountedPtr<channelz::SubchannelNode> channelz_subchannel)
+    RefCountedPtr<channelz::SubchannelNode> channelz_subchannel,
+    WeakRefCountedPtr<Subchannel> subchannel,
+    uint32_t peer_max_concurrent_streams)
     : RefCounted<ConnectedSubchannel>(
           GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel_refcount)
               ? "ConnectedSubchannel"
               : nullptr),
       channel_stack_(channel_stack),
       args_(grpc_channel_args_copy(args)),
-      channelz_subchannel_(std::move(channelz_subchannel)) {}
+      channelz_subchannel_(std::move(channelz_subchannel)),
+      subchannel_(std::move(subchannel)),
+      max_connections_(grpc_channel_args_find_integer(
+          args, GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS, {1, 1, INT_MAX})),
+      streams_per_connection_(
+          GetStreamsPerConnection(args, peer_max_concurrent_streams)) {}
 
 ConnectedSubchannel::~ConnectedSubchannel() {
+  // No call is left on the extra connections: each of them holds a ref to
+  // this primary connection.
+  for (const auto& connection : extra_connections_) {
+    connection->Shutdown();
+  }
   grpc_channel_args_destroy(args_);
   GRPC_CHANNEL_STACK_UNREF(channel_stack_, "connected_subchannel_dtor");
 }
@@ -111,6 +146,14 @@ void ConnectedSubchannel::StartWatch(
   elem->filter->start_transport_op(elem, op);
 }
 
+void ConnectedSubchannel::Shutdown() {
+  grpc_transport_op* op = grpc_make_transport_op(nullptr);
+  op->disconnect_with_error = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+      "Extra subchannel connection closed");
+  grpc_channel_element* elem = grpc_channel_stack_element(channel_stack_, 0);
+  elem->filter->start_transport_op(elem, op);
+}
+
 void ConnectedSubchannel::Ping(grpc_closure* on_initiate,
                                grpc_closure* on_ack) {
   grpc_transport_op* op = grpc_make_transport_op(nullptr);
@@ -126,22 +169,163 @@ size_t ConnectedSubchannel::GetInitialCallSizeEstimate() const {
          channel_stack_->call_stack_size;
 }
 
+RefCountedPtr<ConnectedSubchannel> ConnectedSubchannel::PickConnection(
+    grpc_pollset_set** connecting_interested_parties) {
+  *connecting_interested_parties = nullptr;
+  if (max_connections_ <= 1) return Ref();
+  ConnectedSubchannel* picked = this;
+  bool request_connection = false;
+  {
+    MutexLock lock(&mu_);
+    intptr_t picked_calls = active_calls_.Load(MemoryOrder::RELAXED);
+    for (const auto& connection : extra_connections_) {
+      const intptr_t calls =
+          connection->active_calls_.Load(MemoryOrder::RELAXED);
+      if (calls < picked_calls) {
+        picked = connection.get();
+        picked_calls = calls;
+      }
+    }
+    // Count the call while holding the lock, so that the connection cannot
+    // be closed as idle in the meantime.
+    picked->active_calls_.FetchAdd(1, MemoryOrder::RELAXED);
+    if (picked_calls + 1 >= streams_per_connection_ &&
+        subchannel_ != nullptr && !extra_connection_requested_ &&
+        extra_connections_.size() + 1 <
+            static_cast<size_t>(max_connections_)) {
+      extra_connection_requested_ = true;
+      request_connection = true;
+    }
+    // Once picks stop being queued, nothing else may be polling for the
+    // attempt.
+    if (extra_connection_requested_) {
+      *connecting_interested_parties = subchannel_->pollset_set();
+    }
+  }
+  if (request_connection) {
+    // The subchannel's lock is not to be taken on the data plane.
+    ExecCtx::Run(DEBUG_LOCATION,
+                 GRPC_CLOSURE_CREATE(
+                     RequestExtraConnection,
+                     Ref(DEBUG_LOCATION, "RequestExtraConnection").release(),
+                     nullptr),
+                 GRPC_ERROR_NONE);
+  }
+  return picked->Ref();
+}
+
+void ConnectedSubchannel::RequestExtraConnection(void* arg,
+                                                 grpc_error* /*error*/) {
+  RefCountedPtr<ConnectedSubchannel> self(
+      static_cast<ConnectedSubchannel*>(arg));
+  self->subchannel_->RequestExtraConnection(self.get());
+}
+
+void ConnectedSubchannel::CallFinished() {
+  if (max_connections_ <= 1) return;
+  active_calls_.FetchSub(1, MemoryOrder::RELAXED);
+}
+
+void ConnectedSubchannel::AddExtraConnection(
+    RefCountedPtr<ConnectedSubchannel> connection) {
+  MutexLock lock(&mu_);
+  extra_connection_requested_ = false;
+  extra_connections_.push_back(std::move(connection));
+}
+
+void ConnectedSubchannel::RemoveExtraConnection(
+    ConnectedSubchannel* connection) {
+  RefCountedPtr<ConnectedSubchannel> removed;
+  MutexLock lock(&mu_);
+  for (auto it = extra_connections_.begin(); it != extra_connections_.end();
+       ++it) {
+    if (it->get() == connection) {
+      // Released after the lock, in case this was the last ref.
+      removed = std::move(*it);
+      extra_connections_.erase(it);
+      break;
+    }
+  }
+}
+
+void ConnectedSubchannel::ExtraConnectionFailed() {
+  MutexLock lock(&mu_);
+  extra_connection_requested_ = false;
+}
+
+void ConnectedSubchannel::MaybeCloseIdleConnections() {
+  if (max_connections_ <= 1) return;
+  std::vector<RefCountedPtr<ConnectedSubchannel>> closed;
+  {
+    MutexLock lock(&mu_);
+    intptr_t total_calls = active_calls_.Load(MemoryOrder::RELAXED);
+    for (const auto& connection : extra_connections_) {
+      total_calls += connection->active_calls_.Load(MemoryOrder::RELAXED);
+    }
+    // Only close a connection if the remaining ones would be at most half
+    // full, so that a steady load does not keep opening and closing
+    // connections.
+    for (auto it = extra_connections_.begin();
+         it != extra_connections_.end();) {
+      // The primary plus all other extra connections.
+      const intptr_t remaining =
+          static_cast<intptr_t>(extra_connections_.size());
+      if ((*it)->active_calls_.Load(MemoryOrder::RELAXED) == 0 &&
+          total_calls * 2 <= remaining * streams_per_connection_) {
+        closed.push_back(std::move(*it));
+        it = extra_connections_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  // The connections are no longer picked, so no call can start on them.
+  for (const auto& connection : closed) {
+    connection->Shutdown();
+  }
+}
+
 //
 // SubchannelCall
 //
 
 RefCountedPtr<SubchannelCall> SubchannelCall::Create(Args args,
                                                      grpc_error** error) {
+  RefCountedPtr<ConnectedSubchannel> primary;
+  grpc_pollset_set* connecting_interested_parties;
+  RefCountedPtr<ConnectedSubchannel> connection =
+      args.connected_subchannel->PickConnection(
+          &connecting_interested_parties);
+  if (connection != args.connected_subchannel) {
+    primary = std::move(args.connected_subchannel);
+    args.connected_subchannel = std::move(connection);
+  }
   const size_t allocation_size =
       args.connected_subchannel->GetInitialCallSizeEstimate();
   Arena* arena = args.arena;
-  return RefCountedPtr<SubchannelCall>(new (
-      arena->Alloc(allocation_size)) SubchannelCall(std::move(args), error));
+  return RefCountedPtr<SubchannelCall>(
+      new (arena->Alloc(allocation_size))
+          SubchannelCall(std::move(args), std::move(primary),
+                         connecting_interested_parties, error));
 }
 
-SubchannelCall::SubchannelCall(Args args, grpc_error** error)
+SubchannelCall::SubchannelCall(Args args,
+                               RefCountedPtr<ConnectedSubchannel> primary,
+                               grpc_pollset_set* connecting_interested_parties,
+                               grpc_error** error)
     : connected_subchannel_(std::move(args.connected_subchannel)),
+      primary_(std::move(primary)),
+      connecting_interested_parties_(connecting_interested_parties),
       deadline_(args.deadline) {
+  if (connecting_interested_parties_ != nullptr) {
+    if (grpc_polling_entity_is_empty(args.pollent)) {
+      connecting_interested_parties_ = nullptr;
+    } else {
+      pollent_ = *args.pollent;
+      grpc_polling_entity_add_to_pollset_set(&pollent_,
+                                             connecting_interested_parties_);
+    }
+  }
   grpc_call_stack* callstk = SUBCHANNEL_CALL_TO_CALL_STACK(this);
   const grpc_call_element_args call_args = {
       callstk,           /* call_stack */
@@ -214,6 +398,19 @@ void SubchannelCall::Destroy(void* arg, grpc_error* /*error*/) {
   grpc_closure* after_call_stack_destroy = self->after_call_stack_destroy_;
   RefCountedPtr<ConnectedSubchannel> connected_subchannel =
       std::move(self->connected_subchannel_);
+  RefCountedPtr<ConnectedSubchannel> primary = std::move(self->primary_);
+  if (self->connecting_interested_parties_ != nullptr) {
+    grpc_polling_entity_del_from_pollset_set(
+        &self->pollent_, self->connecting_interested_parties_);
+  }
+  connected_subchannel->CallFinished();
+  // Whichever connection the call was on, one of the extra connections may
+  // now be idle.
+  if (primary != nullptr) {
+    primary->MaybeCloseIdleConnections();
+  } else {
+    connected_subchannel->MaybeCloseIdleConnections();
+  }
   // Destroy the subchannel call.
   self->~SubchannelCall();
   // Destroy the call stack. This should be after destroying the subchannel
@@ -357,6 +554,42 @@ class Subchannel::ConnectedSubchannelStateWatcher
   WeakRefCountedPtr<Subchannel> subchannel_;
 };
 
+//
+// Subchannel::ExtraConnectionStateWatcher
+//
+
+// Drops an extra connection from the current connected subchannel once its
+// transport goes away.
+class Subchannel::ExtraConnectionStateWatcher
+    : public AsyncConnectivityStateWatcherInterface {
+ public:
+  ExtraConnectionStateWatcher(WeakRefCountedPtr<Subchannel> c,
+                              RefCountedPtr<ConnectedSubchannel> connection)
+      : subchannel_(std::move(c)), connection_(std::move(connection)) {}
+
+  ~ExtraConnectionStateWatcher() override {
+    subchannel_.reset(DEBUG_LOCATION, "extra_connection_watcher");
+  }
+
+ private:
+  void OnConnectivityStateChange(grpc_connectivity_state new_state,
+                                 const absl::Status& /*status*/) override {
+    if (new_state != GRPC_CHANNEL_TRANSIENT_FAILURE &&
+        new_state != GRPC_CHANNEL_SHUTDOWN) {
+      return;
+    }
+    Subchannel* c = subchannel_.get();
+    MutexLock lock(&c->mu_);
+    if (c->connected_subchannel_ != nullptr) {
+      c->connected_subchannel_->RemoveExtraConnection(connection_.get());
+    }
+  }
+
+  WeakRefCountedPtr<Subchannel> subchannel_;
+  // Released when the transport shuts down and drops its watchers.
+  RefCountedPtr<ConnectedSubchannel> connection_;
+};
+
 // Asynchronously notifies the \a watcher of a change in the connectvity state
 // of \a subchannel to the current \a state. Deletes itself when done.
 class Subchannel::AsyncWatcherNotifierLocked {
@@ -821,6 +1054,31 @@ void Subchannel::AttemptToConnect() {
   MaybeStartConnectingLocked();
 }
 
+void Subchannel::RequestExtraConnection(ConnectedSubchannel* requester) {
+  MutexLock lock(&mu_);
+  if (requester != connected_subchannel_.get()) {
+    // Stale request from a connection that is no longer in use.
+    return;
+  }
+  if (disconnected_ || connecting_ ||
+      ExecCtx::Get()->Now() < next_extra_connection_attempt_) {
+    requester->ExtraConnectionFailed();
+    return;
+  }
+  if (grpc_trace_subchannel.enabled()) {
+    gpr_log(GPR_INFO, "Subchannel %p: opening extra connection", this);
+  }
+  connecting_ = true;
+  connecting_extra_ = true;
+  WeakRef(DEBUG_LOCATION, "connecting")
+      .release();  // ref held by pending connect
+  SubchannelConnector::Args args;
+  args.interested_parties = pollset_set_;
+  args.deadline = ExecCtx::Get()->Now() + min_connect_timeout_ms_;
+  args.channel_args = args_;
+  connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
+}
+
 void Subchannel::ResetBackoff() {
   MutexLock lock(&mu_);
   backoff_.Reset();
@@ -1005,13 +1263,23 @@ void Subchannel::OnConnectingFinished(void* arg, grpc_error* error) {
   {
     MutexLock lock(&c->mu_);
     c->connecting_ = false;
-    if (c->connecting_result_.transport != nullptr &&
-        c->PublishTransportLocked()) {
+    const bool extra = c->connecting_extra_;
+    c->connecting_extra_ = false;
+    if (extra && c->connected_subchannel_ != nullptr) {
+      c->PublishExtraTransportLocked();
+    } else if (c->connecting_result_.transport != nullptr &&
+               c->PublishTransportLocked()) {
       // Do nothing, transport was published.
     } else if (!c->disconnected_) {
       gpr_log(GPR_INFO, "Connect failed: %s", grpc_error_string(error));
-      c->SetConnectivityStateLocked(GRPC_CHANNEL_TRANSIENT_FAILURE,
-                                    grpc_error_to_absl_status(error));
+      if (extra) {
+        // The connection this was meant to extend failed in the meantime,
+        // which already moved us to TRANSIENT_FAILURE; reconnect instead.
+        c->MaybeStartConnectingLocked();
+      } else {
+        c->SetConnectivityStateLocked(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                                      grpc_error_to_absl_status(error));
+      }
     }
   }
   grpc_channel_args_destroy(delete_channel_args);
@@ -1028,8 +1296,7 @@ void ConnectionDestroy(void* arg, grpc_error* /*error*/) {
 
 }  // namespace
 
-bool Subchannel::PublishTransportLocked() {
-  // Construct channel stack.
+grpc_channel_stack* Subchannel::CreateConnectionStackLocked() {
   grpc_channel_stack_builder* builder = grpc_channel_stack_builder_create();
   grpc_channel_stack_builder_set_channel_arguments(
       builder, connecting_result_.channel_args);
@@ -1037,7 +1304,7 @@ bool Subchannel::PublishTransportLocked() {
                                            connecting_result_.transport);
   if (!grpc_channel_init_create_stack(builder, GRPC_CLIENT_SUBCHANNEL)) {
     grpc_channel_stack_builder_destroy(builder);
-    return false;
+    return nullptr;
   }
   grpc_channel_stack* stk;
   grpc_error* error = grpc_channel_stack_builder_finish(
@@ -1048,10 +1315,19 @@ bool Subchannel::PublishTransportLocked() {
     gpr_log(GPR_ERROR, "error initializing subchannel stack: %s",
             grpc_error_string(error));
     GRPC_ERROR_UNREF(error);
-    return false;
+    return nullptr;
   }
+  return stk;
+}
+
+bool Subchannel::PublishTransportLocked() {
+  // Construct channel stack.
+  grpc_channel_stack* stk = CreateConnectionStackLocked();
+  if (stk == nullptr) return false;
   RefCountedPtr<channelz::SocketNode> socket =
       std::move(connecting_result_.socket_node);
+  const uint32_t max_concurrent_streams =
+      connecting_result_.max_concurrent_streams;
   connecting_result_.Reset();
   if (disconnected_) {
     grpc_channel_stack_destroy(stk);
@@ -1059,8 +1335,9 @@ bool Subchannel::PublishTransportLocked() {
     return false;
   }
   // Publish.
-  connected_subchannel_.reset(
-      new ConnectedSubchannel(stk, args_, channelz_node_));
+  connected_subchannel_.reset(new ConnectedSubchannel(
+      stk, args_, channelz_node_, WeakRef(DEBUG_LOCATION, "connection"),
+      max_concurrent_streams));
   gpr_log(GPR_INFO, "New connected subchannel at %p for subchannel %p",
           connected_subchannel_.get(), this);
   if (channelz_node_ != nullptr) {
@@ -1075,4 +1352,32 @@ bool Subchannel::PublishTransportLocked() {
   return true;
 }
 
+void Subchannel::PublishExtraTransportLocked() {
+  grpc_channel_stack* stk = nullptr;
+  if (connecting_result_.transport != nullptr) {
+    stk = CreateConnectionStackLocked();
+  }
+  connecting_result_.Reset();
+  if (stk == nullptr) {
+    gpr_log(GPR_INFO, "Subchannel %p: failed to open extra connection", this);
+    next_extra_connection_attempt_ =
+        ExecCtx::Get()->Now() +
+        GRPC_SUBCHANNEL_INITIAL_CONNECT_BACKOFF_SECONDS * GPR_MS_PER_SEC;
+    connected_subchannel_->ExtraConnectionFailed();
+    return;
+  }
+  RefCountedPtr<ConnectedSubchannel> connection =
+      MakeRefCounted<ConnectedSubchannel>(stk, args_, channelz_node_);
+  if (grpc_trace_subchannel.enabled()) {
+    gpr_log(GPR_INFO,
+            "Subchannel %p: extra connection %p for connected subchannel %p",
+            this, connection.get(), connected_subchannel_.get());
+  }
+  connection->StartWatch(
+      pollset_set_, MakeOrphanable<ExtraConnectionStateWatcher>(
+                        WeakRef(DEBUG_LOCATION, "extra_connection_watcher"),
+                        connection));
+  connected_subchannel_->AddExtraConnection(std::move(connection));
+}
+
 }  // namespace grpc_core
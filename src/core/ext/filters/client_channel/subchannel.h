@@ -22,6 +22,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <deque>
+#include <vector>
 
 #include "src/core/ext/filters/client_channel/client_channel_channelz.h"
 #include "src/core/ext/filters/client_channel/connector.h"
@@ -29,6 +30,7 @@
 #include "src/core/lib/backoff/backoff.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/gpr/time_precise.h"
+#include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/gprpp/arena.h"
 #include "src/core/lib/gprpp/dual_ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -44,13 +46,20 @@
 
 namespace grpc_core {
 
+class Subchannel;
 class SubchannelCall;
 
 class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
  public:
+  // If \a subchannel is non-null, this is the primary connection of that
+  // subchannel and may ask it for extra connections to the same address
+  // (see GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS). \a peer_max_concurrent_streams
+  // caps the number of calls at which a connection counts as saturated.
   ConnectedSubchannel(
       grpc_channel_stack* channel_stack, const grpc_channel_args* args,
-      RefCountedPtr<channelz::SubchannelNode> channelz_subchannel);
+      RefCountedPtr<channelz::SubchannelNode> channelz_subchannel,
+      WeakRefCountedPtr<Subchannel> subchannel = nullptr,
+      uint32_t peer_max_concurrent_streams = UINT32_MAX);
   ~ConnectedSubchannel() override;
 
   void StartWatch(grpc_pollset_set* interested_parties,
@@ -66,12 +75,44 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
 
   size_t GetInitialCallSizeEstimate() const;
 
+  // Returns the connection a new call should use: the least loaded of this
+  // one and its extra connections. Asks the subchannel for another extra
+  // connection if they are all saturated. The returned connection counts
+  // the call as active until CallFinished() is invoked on it.
+  // While an extra connection is being established, sets
+  // \a connecting_interested_parties to the pollset_set driving the attempt,
+  // so that the call can lend its poller to it; otherwise sets it to null.
+  RefCountedPtr<ConnectedSubchannel> PickConnection(
+      grpc_pollset_set** connecting_interested_parties);
+  void CallFinished();
+
+  // Maintains the set of extra connections. Called by the subchannel.
+  void AddExtraConnection(RefCountedPtr<ConnectedSubchannel> connection);
+  void RemoveExtraConnection(ConnectedSubchannel* connection);
+  void ExtraConnectionFailed();
+  // Closes extra connections without calls if the others have enough room.
+  void MaybeCloseIdleConnections();
+
  private:
+  static void RequestExtraConnection(void* arg, grpc_error* error);
+  // Disconnects the transport of an extra connection that is being closed.
+  void Shutdown();
+
   grpc_channel_stack* channel_stack_;
   grpc_channel_args* args_;
   // ref counted pointer to the channelz node in this connected subchannel's
   // owning subchannel.
   RefCountedPtr<channelz::SubchannelNode> channelz_subchannel_;
+
+  // Connection scaling; only used when max_connections_ > 1.
+  const WeakRefCountedPtr<Subchannel> subchannel_;
+  int max_connections_;
+  intptr_t streams_per_connection_;
+  Atomic<intptr_t> active_calls_{0};
+  Mutex mu_;
+  std::vector<RefCountedPtr<ConnectedSubchannel>> extra_connections_
+      ABSL_GUARDED_BY(mu_);
+  bool extra_connection_requested_ ABSL_GUARDED_BY(mu_) = false;
 };
 
 // Implements the interface of RefCounted<>.
@@ -113,7 +154,9 @@ class SubchannelCall {
   template <typename T>
   friend class RefCountedPtr;
 
-  SubchannelCall(Args args, grpc_error** error);
+  SubchannelCall(Args args, RefCountedPtr<ConnectedSubchannel> primary,
+                 grpc_pollset_set* connecting_interested_parties,
+                 grpc_error** error);
 
   // If channelz is enabled, intercepts recv_trailing so that we may check the
   // status and associate it to a subchannel.
@@ -129,6 +172,13 @@ class SubchannelCall {
   static void Destroy(void* arg, grpc_error* error);
 
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_;
+  // Primary connection of the subchannel, if the call was placed on one of
+  // its extra connections.
+  RefCountedPtr<ConnectedSubchannel> primary_;
+  // If non-null, the call's polling entity was added to this pollset_set to
+  // drive a pending extra connection attempt.
+  grpc_pollset_set* connecting_interested_parties_;
+  grpc_polling_entity pollent_;
   grpc_closure* after_call_stack_destroy_ = nullptr;
   // State needed to support channelz interception of recv trailing metadata.
   grpc_closure recv_trailing_metadata_ready_;
@@ -245,6 +295,13 @@ class Subchannel : public DualRefCounted<Subchannel> {
   // Attempt to connect to the backend.  Has no effect if already connected.
   void AttemptToConnect() ABSL_LOCKS_EXCLUDED(mu_);
 
+  // Opens an extra connection for \a requester if it is still the current
+  // connection and no connection attempt is under way.
+  void RequestExtraConnection(ConnectedSubchannel* requester)
+      ABSL_LOCKS_EXCLUDED(mu_);
+
+  grpc_pollset_set* pollset_set() const { return pollset_set_; }
+
   // Resets the connection backoff of the subchannel.
   // TODO(roth): Move connection backoff out of subchannels and up into LB
   // policy code (probably by adding a SubchannelGroup between
@@ -330,6 +387,7 @@ class Subchannel : public DualRefCounted<Subchannel> {
   };
 
   class ConnectedSubchannelStateWatcher;
+  class ExtraConnectionStateWatcher;
 
   class AsyncWatcherNotifierLocked;
 
@@ -345,7 +403,10 @@ class Subchannel : public DualRefCounted<Subchannel> {
   void ContinueConnectingLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   static void OnConnectingFinished(void* arg, grpc_error* error)
       ABSL_LOCKS_EXCLUDED(mu_);
+  grpc_channel_stack* CreateConnectionStackLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void PublishExtraTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
@@ -370,6 +431,10 @@ class Subchannel : public DualRefCounted<Subchannel> {
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
   bool connecting_ ABSL_GUARDED_BY(mu_) = false;
+  // The pending connection attempt is for an extra connection.
+  bool connecting_extra_ ABSL_GUARDED_BY(mu_) = false;
+  // No extra connection is attempted before this time after one failed.
+  grpc_millis next_extra_connection_attempt_ ABSL_GUARDED_BY(mu_) = 0;
   bool disconnected_ ABSL_GUARDED_BY(mu_) = false;
 
   // Connectivity state tracking.
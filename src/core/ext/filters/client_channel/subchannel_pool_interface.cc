@@ -31,46 +31,21 @@ namespace grpc_core {
 
 TraceFlag grpc_subchannel_pool_trace(false, "subchannel_pool");
 
-SubchannelKey::SubchannelKey(const grpc_channel_args* args) {
-  Init(args, grpc_channel_args_normalize);
-}
+SubchannelKey::Args::Args(const grpc_channel_args* args)
+    : args_(grpc_channel_args_normalize(args)),
+      hash_(grpc_channel_args_hash(args_)) {}
 
-SubchannelKey::~SubchannelKey() {
-  grpc_channel_args_destroy(const_cast<grpc_channel_args*>(args_));
-}
+SubchannelKey::Args::~Args() { grpc_channel_args_destroy(args_); }
 
-SubchannelKey::SubchannelKey(const SubchannelKey& other) {
-  Init(other.args_, grpc_channel_args_copy);
-}
-
-SubchannelKey& SubchannelKey::operator=(const SubchannelKey& other) {
-  if (&other == this) {
-    return *this;
-  }
-  grpc_channel_args_destroy(const_cast<grpc_channel_args*>(args_));
-  Init(other.args_, grpc_channel_args_copy);
-  return *this;
-}
-
-SubchannelKey::SubchannelKey(SubchannelKey&& other) noexcept {
-  args_ = other.args_;
-  other.args_ = nullptr;
-}
-
-SubchannelKey& SubchannelKey::operator=(SubchannelKey&& other) noexcept {
-  args_ = other.args_;
-  other.args_ = nullptr;
-  return *this;
-}
+SubchannelKey::SubchannelKey(const grpc_channel_args* args)
+    : args_(MakeRefCounted<Args>(args)) {}
 
 bool SubchannelKey::operator<(const SubchannelKey& other) const {
-  return grpc_channel_args_compare(args_, other.args_) < 0;
-}
-
-void SubchannelKey::Init(
-    const grpc_channel_args* args,
-    grpc_channel_args* (*copy_channel_args)(const grpc_channel_args* args)) {
-  args_ = copy_channel_args(args);
+  if (args_ == other.args_) return false;
+  if (args_->hash() != other.args_->hash()) {
+    return args_->hash() < other.args_->hash();
+  }
+  return grpc_channel_args_compare(args_->args(), other.args_->args()) < 0;
 }
 
 namespace {
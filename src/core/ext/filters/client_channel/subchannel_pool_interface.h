@@ -25,6 +25,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 
 namespace grpc_core {
 
@@ -33,28 +34,38 @@ class Subchannel;
 extern TraceFlag grpc_subchannel_pool_trace;
 
 // A key that can uniquely identify a subchannel.
+// The normalized args and their hash are computed once and shared by all
+// copies of the key, so copying and ordering keys does not walk the args
+// unless two keys actually hash the same.
 class SubchannelKey {
  public:
   explicit SubchannelKey(const grpc_channel_args* args);
-  ~SubchannelKey();
 
   // Copyable.
-  SubchannelKey(const SubchannelKey& other);
-  SubchannelKey& operator=(const SubchannelKey& other);
+  SubchannelKey(const SubchannelKey& other) = default;
+  SubchannelKey& operator=(const SubchannelKey& other) = default;
   // Movable
-  SubchannelKey(SubchannelKey&&) noexcept;
-  SubchannelKey& operator=(SubchannelKey&&) noexcept;
+  SubchannelKey(SubchannelKey&&) noexcept = default;
+  SubchannelKey& operator=(SubchannelKey&&) noexcept = default;
 
+  // Orders by hash first; the resulting order is arbitrary but consistent.
   bool operator<(const SubchannelKey& other) const;
 
  private:
-  // Initializes the subchannel key with the given \a args and the function to
-  // copy channel args.
-  void Init(
-      const grpc_channel_args* args,
-      grpc_channel_args* (*copy_channel_args)(const grpc_channel_args* args));
+  class Args : public RefCounted<Args> {
+   public:
+    explicit Args(const grpc_channel_args* args);
+    ~Args() override;
 
-  const grpc_channel_args* args_;
+    const grpc_channel_args* args() const { return args_; }
+    size_t hash() const { return hash_; }
+
+   private:
+    grpc_channel_args* args_;
+    size_t hash_;
+  };
+
+  RefCountedPtr<Args> args_;
 };
 
 // Interface for subchannel pool.
@@ -25,6 +25,7 @@
 #include "src/core/ext/filters/http/message_compress/message_decompress_filter.h"
 #include "src/core/ext/filters/http/server/http_server_filter.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/compression/compression_args.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/transport/transport_impl.h"
@@ -72,7 +73,33 @@ static bool maybe_add_required_filter(grpc_channel_stack_builder* builder,
              : true;
 }
 
+// Loads the preset compression dictionary into the channel args, so that the
+// compress and decompress filters share one copy. Subchannels inherit it from
+// their parent channel.
+static bool maybe_load_compression_dictionary(
+    grpc_channel_stack_builder* builder, void* /*arg*/) {
+  grpc_channel_args* new_args = grpc_channel_args_load_compression_dictionary(
+      grpc_channel_stack_builder_get_channel_arguments(builder));
+  if (new_args != nullptr) {
+    grpc_channel_stack_builder_set_channel_arguments(builder, new_args);
+    grpc_channel_args_destroy(new_args);
+  }
+  return true;
+}
+
 void grpc_http_filters_init(void) {
+  grpc_channel_init_register_stage(GRPC_CLIENT_CHANNEL,
+                                   GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
+                                   maybe_load_compression_dictionary, nullptr);
+  grpc_channel_init_register_stage(GRPC_CLIENT_SUBCHANNEL,
+                                   GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
+                                   maybe_load_compression_dictionary, nullptr);
+  grpc_channel_init_register_stage(GRPC_CLIENT_DIRECT_CHANNEL,
+                                   GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
+                                   maybe_load_compression_dictionary, nullptr);
+  grpc_channel_init_register_stage(GRPC_SERVER_CHANNEL,
+                                   GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
+                                   maybe_load_compression_dictionary, nullptr);
   grpc_channel_init_register_stage(
       GRPC_CLIENT_SUBCHANNEL, GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
       maybe_add_optional_filter<false>, &compress_filter);
@@ -19,8 +19,11 @@
 #include <grpc/support/port_platform.h>
 
 #include <assert.h>
+#include <stdio.h>
 #include <string.h>
 
+#include <atomic>
+
 #include "absl/types/optional.h"
 
 #include <grpc/compression.h>
@@ -44,12 +47,18 @@
 
 namespace {
 
+// Carries the id of the preset dictionary a peer holds, as 8 hex digits.
+constexpr char kDictionaryMdKey[] = "grpc-encoding-dictionary";
+
 class ChannelData {
  public:
   explicit ChannelData(grpc_channel_element_args* args) {
     // Get the enabled and the default algorithms from channel args.
+    // Algorithms that were not compiled in can be neither used nor advertised.
     enabled_compression_algorithms_bitset_ =
-        grpc_channel_args_compression_algorithm_get_states(args->channel_args);
+        grpc_channel_args_compression_algorithm_get_states(
+            args->channel_args) &
+        grpc_compression_algorithms_available_bitset();
     default_compression_algorithm_ =
         grpc_channel_args_get_channel_default_compression_algorithm(
             args->channel_args);
@@ -70,9 +79,25 @@ class ChannelData {
     enabled_stream_compression_algorithms_bitset_ =
         grpc_compression_bitset_to_stream_bitset(
             enabled_compression_algorithms_bitset_);
+    accept_encoding_md_ = grpc_message_compression_accept_encoding_mdelem(
+        enabled_message_compression_algorithms_bitset_);
+    dictionary_ = grpc_core::CompressionDictionary::GetFromChannelArgs(
+        args->channel_args);
+    if (dictionary_ != nullptr) {
+      char id[9];
+      snprintf(id, sizeof(id), "%08x", dictionary_->id());
+      dictionary_md_ = grpc_mdelem_from_slices(
+          grpc_core::ManagedMemorySlice(kDictionaryMdKey),
+          grpc_core::ManagedMemorySlice(id));
+    }
     GPR_ASSERT(!args->is_last);
   }
 
+  ~ChannelData() {
+    GRPC_MDELEM_UNREF(accept_encoding_md_);
+    GRPC_MDELEM_UNREF(dictionary_md_);
+  }
+
   grpc_compression_algorithm default_compression_algorithm() const {
     return default_compression_algorithm_;
   }
@@ -89,6 +114,22 @@ class ChannelData {
     return enabled_stream_compression_algorithms_bitset_;
   }
 
+  grpc_mdelem accept_encoding_md() const { return accept_encoding_md_; }
+
+  bool has_dictionary() const { return dictionary_ != nullptr; }
+
+  const grpc_slice& dictionary() const { return dictionary_->data(); }
+
+  grpc_mdelem dictionary_md() const { return dictionary_md_; }
+
+  bool peer_has_dictionary() const {
+    return peer_has_dictionary_.load(std::memory_order_relaxed);
+  }
+
+  void set_peer_has_dictionary(bool peer_has_dictionary) {
+    peer_has_dictionary_.store(peer_has_dictionary, std::memory_order_relaxed);
+  }
+
  private:
   /** The default, channel-level, compression algorithm */
   grpc_compression_algorithm default_compression_algorithm_;
@@ -98,6 +139,18 @@ class ChannelData {
   uint32_t enabled_message_compression_algorithms_bitset_;
   /** Bitset of enabled stream compression algorithms */
   uint32_t enabled_stream_compression_algorithms_bitset_;
+  /** grpc-accept-encoding metadata advertising the enabled message
+   * compression algorithms */
+  grpc_mdelem accept_encoding_md_;
+  /** Preset dictionary messages may be compressed against, if any. It is
+   * shared with the decompress filter through channel args. */
+  grpc_core::RefCountedPtr<grpc_core::CompressionDictionary> dictionary_;
+  /** grpc-encoding-dictionary metadata advertising the dictionary, or
+   * GRPC_MDNULL if the channel has none */
+  grpc_mdelem dictionary_md_ = GRPC_MDNULL;
+  /** On clients, whether the server on this connection advertised the same
+   * dictionary in the initial metadata of an earlier call */
+  std::atomic<bool> peer_has_dictionary_{false};
 };
 
 class CallData {
@@ -113,8 +166,17 @@ class CallData {
           grpc_compression_algorithm_to_message_compression_algorithm(
               channeld->default_compression_algorithm());
     }
+    // Messages are only compressed against the dictionary once the peer has
+    // advertised the same one. Servers learn it from the client's initial
+    // metadata; clients from the server's, so until a response on this
+    // connection has carried it they send plain deflate.
+    is_server_ = args.server_transport_data != nullptr;
+    use_dictionary_ = !is_server_ && channeld->peer_has_dictionary();
     GRPC_CLOSURE_INIT(&start_send_message_batch_in_call_combiner_,
                       StartSendMessageBatch, elem, grpc_schedule_on_exec_ctx);
+    GRPC_CLOSURE_INIT(&on_recv_initial_metadata_ready_,
+                      OnRecvInitialMetadataReady, elem,
+                      grpc_schedule_on_exec_ctx);
   }
 
   ~CallData() {
@@ -134,6 +196,8 @@ class CallData {
   grpc_error* ProcessSendInitialMetadata(grpc_call_element* elem,
                                          grpc_metadata_batch* initial_metadata);
 
+  static void OnRecvInitialMetadataReady(void* elem_arg, grpc_error* error);
+
   // Methods for processing a send_message batch
   static void StartSendMessageBatch(void* elem_arg, grpc_error* unused);
   static void OnSendMessageNextDone(void* elem_arg, grpc_error* error);
@@ -152,6 +216,12 @@ class CallData {
   grpc_error* cancel_error_ = GRPC_ERROR_NONE;
   grpc_transport_stream_op_batch* send_message_batch_ = nullptr;
   bool seen_initial_metadata_ = false;
+  bool is_server_;
+  /* Whether messages are compressed against the channel's dictionary */
+  bool use_dictionary_;
+  grpc_closure on_recv_initial_metadata_ready_;
+  grpc_closure* original_recv_initial_metadata_ready_ = nullptr;
+  grpc_metadata_batch* recv_initial_metadata_ = nullptr;
   /* Set to true, if the fields below are initialized. */
   bool state_initialized_ = false;
   grpc_closure start_send_message_batch_in_call_combiner_;
@@ -162,6 +232,7 @@ class CallData {
   grpc_linked_mdelem stream_compression_algorithm_storage_;
   grpc_linked_mdelem accept_encoding_storage_;
   grpc_linked_mdelem accept_stream_encoding_storage_;
+  grpc_linked_mdelem dictionary_storage_;
   grpc_slice_buffer slices_; /**< Buffers up input slices to be compressed */
   // Allocate space for the replacement stream
   std::aligned_storage<sizeof(grpc_core::SliceBufferByteStream),
@@ -265,8 +336,7 @@ grpc_error* CallData::ProcessSendInitialMetadata(
   // Convey supported compression algorithms.
   error = grpc_metadata_batch_add_tail(
       initial_metadata, &accept_encoding_storage_,
-      GRPC_MDELEM_ACCEPT_ENCODING_FOR_ALGORITHMS(
-          channeld->enabled_message_compression_algorithms_bitset()),
+      GRPC_MDELEM_REF(channeld->accept_encoding_md()),
       GRPC_BATCH_GRPC_ACCEPT_ENCODING);
   if (error != GRPC_ERROR_NONE) return error;
   // Do not overwrite accept-encoding header if it already presents (e.g., added
@@ -277,10 +347,43 @@ grpc_error* CallData::ProcessSendInitialMetadata(
         GRPC_MDELEM_ACCEPT_STREAM_ENCODING_FOR_ALGORITHMS(
             channeld->enabled_stream_compression_algorithms_bitset()),
         GRPC_BATCH_ACCEPT_ENCODING);
+    if (error != GRPC_ERROR_NONE) return error;
+  }
+  // Advertise the dictionary so that the peer can compress against it too.
+  if (channeld->has_dictionary()) {
+    error = grpc_metadata_batch_add_tail(
+        initial_metadata, &dictionary_storage_,
+        GRPC_MDELEM_REF(channeld->dictionary_md()));
   }
   return error;
 }
 
+// Checks whether the peer holds the same dictionary. Clients remember the
+// answer for later calls on the same connection.
+void CallData::OnRecvInitialMetadataReady(void* elem_arg, grpc_error* error) {
+  grpc_call_element* elem = static_cast<grpc_call_element*>(elem_arg);
+  CallData* calld = static_cast<CallData*>(elem->call_data);
+  ChannelData* channeld = static_cast<ChannelData*>(elem->channel_data);
+  if (error == GRPC_ERROR_NONE) {
+    bool peer_has_dictionary = false;
+    for (grpc_linked_mdelem* l = calld->recv_initial_metadata_->list.head;
+         l != nullptr; l = l->next) {
+      if (grpc_slice_str_cmp(GRPC_MDKEY(l->md), kDictionaryMdKey) == 0) {
+        peer_has_dictionary = grpc_slice_eq(
+            GRPC_MDVALUE(l->md), GRPC_MDVALUE(channeld->dictionary_md()));
+        break;
+      }
+    }
+    calld->use_dictionary_ = peer_has_dictionary;
+    if (!calld->is_server_) {
+      channeld->set_peer_has_dictionary(peer_has_dictionary);
+    }
+  }
+  grpc_closure* closure = calld->original_recv_initial_metadata_ready_;
+  calld->original_recv_initial_metadata_ready_ = nullptr;
+  grpc_core::Closure::Run(DEBUG_LOCATION, closure, GRPC_ERROR_REF(error));
+}
+
 void CallData::SendMessageOnComplete(void* calld_arg, grpc_error* error) {
   CallData* calld = static_cast<CallData*>(calld_arg);
   grpc_slice_buffer_reset_and_unref_internal(&calld->slices_);
@@ -305,8 +408,11 @@ void CallData::FinishSendMessage(grpc_call_element* elem) {
   grpc_slice_buffer_init(&tmp);
   uint32_t send_flags =
       send_message_batch_->payload->send_message.send_message->flags();
-  bool did_compress =
-      grpc_msg_compress(message_compression_algorithm_, &slices_, &tmp);
+  ChannelData* channeld = static_cast<ChannelData*>(elem->channel_data);
+  bool did_compress = grpc_msg_compress_with_dictionary(
+      message_compression_algorithm_,
+      use_dictionary_ ? channeld->dictionary() : grpc_empty_slice(), &slices_,
+      &tmp);
   if (did_compress) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
       const char* algo_name;
@@ -455,6 +561,16 @@ void CallData::CompressStartTransportStreamOpBatch(
         batch, GRPC_ERROR_REF(cancel_error_), call_combiner_);
     return;
   }
+  // Handle recv_initial_metadata: only channels with a dictionary care.
+  if (batch->recv_initial_metadata &&
+      static_cast<ChannelData*>(elem->channel_data)->has_dictionary()) {
+    recv_initial_metadata_ =
+        batch->payload->recv_initial_metadata.recv_initial_metadata;
+    original_recv_initial_metadata_ready_ =
+        batch->payload->recv_initial_metadata.recv_initial_metadata_ready;
+    batch->payload->recv_initial_metadata.recv_initial_metadata_ready =
+        &on_recv_initial_metadata_ready_;
+  }
   // Handle send_initial_metadata.
   if (batch->send_initial_metadata) {
     GPR_ASSERT(!seen_initial_metadata_);
@@ -47,18 +47,29 @@ namespace {
 class ChannelData {
  public:
   explicit ChannelData(const grpc_channel_element_args* args)
-      : max_recv_size_(GetMaxRecvSizeFromChannelArgs(args->channel_args)) {}
+      : max_recv_size_(GetMaxRecvSizeFromChannelArgs(args->channel_args)),
+        dictionary_(
+            CompressionDictionary::GetFromChannelArgs(args->channel_args)) {}
 
   int max_recv_size() const { return max_recv_size_; }
 
+  // Empty if the channel has no dictionary.
+  grpc_slice dictionary() const {
+    return dictionary_ != nullptr ? dictionary_->data() : grpc_empty_slice();
+  }
+
  private:
   int max_recv_size_;
+  // Preset dictionary offered to messages compressed against one, shared with
+  // the compress filter through channel args.
+  RefCountedPtr<CompressionDictionary> dictionary_;
 };
 
 class CallData {
  public:
   CallData(const grpc_call_element_args& args, const ChannelData* chand)
       : call_combiner_(args.call_combiner),
+        dictionary_(chand->dictionary()),
         max_recv_message_length_(chand->max_recv_size()) {
     // Initialize state for recv_initial_metadata_ready callback
     GRPC_CLOSURE_INIT(&on_recv_initial_metadata_ready_,
@@ -105,6 +116,8 @@ class CallData {
   static void OnRecvTrailingMetadataReady(void* arg, grpc_error* error);
 
   CallCombiner* call_combiner_;
+  // The channel's preset dictionary, unowned; the channel outlives the call.
+  const grpc_slice dictionary_;
   // Overall error for the call
   grpc_error* error_ = GRPC_ERROR_NONE;
   // Fields for handling recv_initial_metadata_ready callback
@@ -257,8 +270,11 @@ void CallData::OnRecvMessageNextDone(void* arg, grpc_error* error) {
 void CallData::FinishRecvMessage() {
   grpc_slice_buffer decompressed_slices;
   grpc_slice_buffer_init(&decompressed_slices);
-  if (grpc_msg_decompress(algorithm_, &recv_slices_, &decompressed_slices) ==
-      0) {
+  // Messages are self-describing: those compressed without the dictionary
+  // decompress the same with it.
+  if (grpc_msg_decompress_with_dictionary(algorithm_, dictionary_,
+                                          &recv_slices_,
+                                          &decompressed_slices) == 0) {
     GPR_DEBUG_ASSERT(error_ == GRPC_ERROR_NONE);
     error_ = GRPC_ERROR_CREATE_FROM_COPIED_STRING(
         absl::StrCat("Unexpected error decompressing data for algorithm with "
@@ -208,6 +208,10 @@ void Chttp2Connector::OnReceiveSettings(void* arg, grpc_error* error) {
         grpc_transport_destroy(self->result_->transport);
         grpc_channel_args_destroy(self->result_->channel_args);
         self->result_->Reset();
+      } else {
+        self->result_->max_concurrent_streams =
+            grpc_chttp2_transport_get_peer_max_concurrent_streams(
+                self->result_->transport);
       }
       self->MaybeNotify(GRPC_ERROR_REF(error));
       grpc_timer_cancel(&self->timer_);
@@ -24,6 +24,8 @@
 
 #include <grpc/support/log.h>
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/slice/b64.h"
 
 static const char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
@@ -55,17 +57,11 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   grpc_slice output = GRPC_SLICE_MALLOC(output_length);
   const uint8_t* in = GRPC_SLICE_START_PTR(input);
   char* out = reinterpret_cast<char*> GRPC_SLICE_START_PTR(output);
-  size_t i;
 
   /* encode full triplets */
-  for (i = 0; i < input_triplets; i++) {
-    out[0] = alphabet[in[0] >> 2];
-    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
-    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
-    out[3] = alphabet[in[2] & 0x3f];
-    out += 4;
-    in += 3;
-  }
+  grpc_base64_encode_triplets(in, input_triplets, out, /*url_safe=*/0);
+  out += 4 * input_triplets;
+  in += 3 * input_triplets;
 
   /* encode the remaining bytes */
   switch (tail_case) {
@@ -96,7 +92,9 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   const uint8_t* in;
   uint8_t* out;
   grpc_slice output;
-  uint32_t temp = 0;
+  /* codes are at most 30 bits long, so with fewer than 32 bits pending there
+     is always room for the next one: output is flushed a word at a time */
+  uint64_t temp = 0;
   uint32_t temp_length = 0;
 
   nbits = 0;
@@ -109,17 +107,26 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   out = GRPC_SLICE_START_PTR(output);
   for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
        ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    temp = (temp << sym.length) | sym.bits;
+    temp_length += sym.length;
+
+    if (temp_length >= 32) {
+      temp_length -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp >> temp_length);
+      out[0] = static_cast<uint8_t>(word >> 24);
+      out[1] = static_cast<uint8_t>(word >> 16);
+      out[2] = static_cast<uint8_t>(word >> 8);
+      out[3] = static_cast<uint8_t>(word);
+      out += 4;
     }
   }
 
+  while (temp_length >= 8) {
+    temp_length -= 8;
+    *out++ = static_cast<uint8_t>(temp >> temp_length);
+  }
+
   if (temp_length) {
     /* NB: the following integer arithmetic operation needs to be in its
      * expanded form due to the "integral promotion" performed (see section
@@ -135,13 +142,28 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   return output;
 }
 
+/* base64 chars have huffman codes of at most 11 bits, so with fewer than 32
+   bits pending there is always room for two more: output is flushed a word
+   at a time */
 struct huff_out {
-  uint32_t temp;
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
 static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
+  if (out->temp_length >= 32) {
+    out->temp_length -= 32;
+    const uint32_t word = static_cast<uint32_t>(out->temp >> out->temp_length);
+    out->out[0] = static_cast<uint8_t>(word >> 24);
+    out->out[1] = static_cast<uint8_t>(word >> 16);
+    out->out[2] = static_cast<uint8_t>(word >> 8);
+    out->out[3] = static_cast<uint8_t>(word);
+    out->out += 4;
+  }
+}
+
+static void enc_flush_bytes(huff_out* out) {
+  while (out->temp_length >= 8) {
     out->temp_length -= 8;
     *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
   }
@@ -164,6 +186,20 @@ static void enc_add1(huff_out* out, uint8_t a) {
   enc_flush_some(out);
 }
 
+/* huffman compress already base64 encoded chars */
+static void enc_add_chars(huff_out* out, const char* chars, size_t length) {
+  for (size_t i = 0; i < length; i += 2) {
+    const grpc_chttp2_huffsym& sa =
+        grpc_chttp2_huffsyms[static_cast<uint8_t>(chars[i])];
+    const grpc_chttp2_huffsym& sb =
+        grpc_chttp2_huffsyms[static_cast<uint8_t>(chars[i + 1])];
+    out->temp = (out->temp << (sa.length + sb.length)) |
+                (static_cast<uint64_t>(sa.bits) << sb.length) | sb.bits;
+    out->temp_length += sa.length + sb.length;
+    enc_flush_some(out);
+  }
+}
+
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     const grpc_slice& input) {
   size_t input_length = GRPC_SLICE_LENGTH(input);
@@ -182,16 +218,15 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   out.temp_length = 0;
   out.out = start_out;
 
-  /* encode full triplets */
-  for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f);
-    in += 3;
+  /* encode full triplets: base64 a chunk at a time, then compress it */
+  char chunk[4 * 64];
+  for (i = 0; i < input_triplets;) {
+    const size_t num_triplets =
+        GPR_MIN(input_triplets - i, sizeof(chunk) / 4);
+    grpc_base64_encode_triplets(in, num_triplets, chunk, /*url_safe=*/0);
+    enc_add_chars(&out, chunk, 4 * num_triplets);
+    in += 3 * num_triplets;
+    i += num_triplets;
   }
 
   /* encode the remaining bytes */
@@ -212,6 +247,7 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     }
   }
 
+  enc_flush_bytes(&out);
   if (out.temp_length) {
     /* NB: the following integer arithmetic operation needs to be in its
      * expanded form due to the "integral promotion" performed (see section
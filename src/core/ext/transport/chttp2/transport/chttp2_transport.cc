@@ -60,6 +60,7 @@
 #define DEFAULT_CONNECTION_WINDOW_TARGET (1024 * 1024)
 #define MAX_WINDOW 0x7fffffffu
 #define MAX_WRITE_BUFFER_SIZE (64 * 1024 * 1024)
+#define DEFAULT_WRITE_COALESCING_MAX_BYTES (64 * 1024)
 #define DEFAULT_MAX_HEADER_LIST_SIZE (8 * 1024)
 
 #define DEFAULT_CLIENT_KEEPALIVE_TIME_MS INT_MAX
@@ -104,6 +105,8 @@ static void write_action_begin_locked(void* t, grpc_error* error);
 static void write_action(void* t, grpc_error* error);
 static void write_action_end(void* t, grpc_error* error);
 static void write_action_end_locked(void* t, grpc_error* error);
+static void write_coalescing_done(void* t, grpc_error* error);
+static void write_coalescing_done_locked(void* t, grpc_error* error);
 
 static void read_action(void* t, grpc_error* error);
 static void read_action_locked(void* t, grpc_error* error);
@@ -303,6 +306,19 @@ static bool read_channel_args(grpc_chttp2_transport* t,
                            GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)) {
       t->write_buffer_size = static_cast<uint32_t>(grpc_channel_arg_get_integer(
           &channel_args->args[i], {0, 0, MAX_WRITE_BUFFER_SIZE}));
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US)) {
+      const int value = grpc_channel_arg_get_integer(&channel_args->args[i],
+                                                     {0, 0, INT_MAX});
+      // Timers only have millisecond granularity: round up.
+      t->write_coalescing_window =
+          (static_cast<grpc_millis>(value) + GPR_US_PER_MS - 1) / GPR_US_PER_MS;
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_BYTES)) {
+      t->write_coalescing_max_bytes =
+          static_cast<uint32_t>(grpc_channel_arg_get_integer(
+              &channel_args->args[i],
+              {DEFAULT_WRITE_COALESCING_MAX_BYTES, 0, MAX_WRITE_BUFFER_SIZE}));
     } else if (0 ==
                strcmp(channel_args->args[i].key, GRPC_ARG_HTTP2_BDP_PROBE)) {
       enable_bdp = grpc_channel_arg_get_bool(&channel_args->args[i], true);
@@ -561,6 +577,10 @@ static void close_transport_locked(grpc_chttp2_transport* t,
                                  GRPC_STATUS_UNAVAILABLE);
     }
     if (t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE) {
+      if (t->write_coalescing_timer_pending) {
+        // Don't hold the close back for the rest of the coalescing window.
+        grpc_timer_cancel(&t->write_coalescing_timer);
+      }
       if (t->close_transport_on_writes_finished == nullptr) {
         t->close_transport_on_writes_finished =
             GRPC_ERROR_CREATE_FROM_STATIC_STRING(
@@ -895,6 +915,20 @@ static void inc_initiate_write_reason(
   }
 }
 
+// Can a write initiated for this reason wait for the coalescing window?
+// Only RPC traffic can: control frames go out as soon as possible.
+static bool write_can_be_coalesced(grpc_chttp2_initiate_write_reason reason) {
+  switch (reason) {
+    case GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_INITIAL_METADATA:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_TRAILING_METADATA:
+      return true;
+    default:
+      return false;
+  }
+}
+
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
   GPR_TIMER_SCOPE("grpc_chttp2_initiate_write", 0);
@@ -905,6 +939,22 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
       GRPC_CHTTP2_REF_TRANSPORT(t, "writing");
+      // With a coalescing window configured, hold the write back for a little
+      // while so that frames from other streams started in the meantime go
+      // out in the same endpoint write. The transport stays in the WRITING
+      // state, so that on_complete callbacks wait for the write as usual.
+      if (t->write_coalescing_window > 0 && write_can_be_coalesced(reason) &&
+          t->write_coalescing_bytes < t->write_coalescing_max_bytes) {
+        GRPC_STATS_INC_HTTP2_WRITES_COALESCED();
+        t->write_coalescing_timer_pending = true;
+        GRPC_CLOSURE_INIT(&t->write_coalescing_done_locked,
+                          write_coalescing_done, t, grpc_schedule_on_exec_ctx);
+        grpc_timer_init(
+            &t->write_coalescing_timer,
+            grpc_core::ExecCtx::Get()->Now() + t->write_coalescing_window,
+            &t->write_coalescing_done_locked);
+        break;
+      }
       // Note that the 'write_action_begin_locked' closure is being scheduled
       // on the 'finally_scheduler' of t->combiner. This means that
       // 'write_action_begin_locked' is called only *after* all the other
@@ -927,6 +977,16 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
           GRPC_ERROR_NONE);
       break;
     case GRPC_CHTTP2_WRITE_STATE_WRITING:
+      if (t->write_coalescing_timer_pending) {
+        // The held back write has not gathered anything yet, so it will
+        // include whatever was just queued. Only decide whether to stop
+        // waiting for more.
+        if (!write_can_be_coalesced(reason) ||
+            t->write_coalescing_bytes >= t->write_coalescing_max_bytes) {
+          grpc_timer_cancel(&t->write_coalescing_timer);
+        }
+        break;
+      }
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
                       grpc_chttp2_initiate_write_reason_string(reason));
       break;
@@ -935,6 +995,30 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
   }
 }
 
+static void write_coalescing_done(void* tp, grpc_error* error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  t->combiner->Run(GRPC_CLOSURE_INIT(&t->write_coalescing_done_locked,
+                                     write_coalescing_done_locked, t, nullptr),
+                   GRPC_ERROR_REF(error));
+}
+
+// The coalescing window is over, either because the timer fired or because it
+// was cut short: start gathering the write held back by
+// grpc_chttp2_initiate_write.
+static void write_coalescing_done_locked(void* tp, grpc_error* error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  GPR_ASSERT(t->write_coalescing_timer_pending);
+  GPR_ASSERT(t->write_state == GRPC_CHTTP2_WRITE_STATE_WRITING);
+  t->write_coalescing_timer_pending = false;
+  if (error == GRPC_ERROR_CANCELLED) {
+    GRPC_STATS_INC_HTTP2_COALESCED_WRITES_CUT_SHORT();
+  }
+  t->combiner->FinallyRun(
+      GRPC_CLOSURE_INIT(&t->write_action_begin_locked,
+                        write_action_begin_locked, t, nullptr),
+      GRPC_ERROR_NONE);
+}
+
 void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
                                       grpc_chttp2_stream* s) {
   if (t->closed_with_error == GRPC_ERROR_NONE &&
@@ -955,6 +1039,7 @@ static void write_action_begin_locked(void* gt, grpc_error* /*error_ignored*/) {
   GPR_TIMER_SCOPE("write_action_begin_locked", 0);
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
   GPR_ASSERT(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
+  t->write_coalescing_bytes = 0;
   grpc_chttp2_begin_write_result r;
   if (t->closed_with_error != GRPC_ERROR_NONE) {
     r.writing = false;
@@ -1505,6 +1590,7 @@ static void perform_stream_op_locked(void* stream_op,
       s->fetching_send_message =
           std::move(op_payload->send_message.send_message);
       s->fetched_send_message_length = 0;
+      t->write_coalescing_bytes += len;
       s->next_message_end_offset =
           s->flow_controlled_bytes_written +
           static_cast<int64_t>(s->flow_controlled_buffer.length) +
@@ -3314,6 +3400,14 @@ grpc_chttp2_transport_get_socket_node(grpc_transport* transport) {
   return t->channelz_socket;
 }
 
+uint32_t grpc_chttp2_transport_get_peer_max_concurrent_streams(
+    grpc_transport* transport) {
+  grpc_chttp2_transport* t =
+      reinterpret_cast<grpc_chttp2_transport*>(transport);
+  return t->settings[GRPC_PEER_SETTINGS]
+                    [GRPC_CHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS];
+}
+
 grpc_transport* grpc_create_chttp2_transport(
     const grpc_channel_args* channel_args, grpc_endpoint* ep, bool is_client,
     grpc_resource_user* resource_user) {
@@ -41,6 +41,12 @@ grpc_transport* grpc_create_chttp2_transport(
 grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode>
 grpc_chttp2_transport_get_socket_node(grpc_transport* transport);
 
+/// Returns the MAX_CONCURRENT_STREAMS setting last received from the peer.
+/// Meant to be called from \a notify_on_receive_settings (see below); the
+/// peer may change the value later.
+uint32_t grpc_chttp2_transport_get_peer_max_concurrent_streams(
+    grpc_transport* transport);
+
 /// Takes ownership of \a read_buffer, which (if non-NULL) contains
 /// leftover bytes previously read from the endpoint (e.g., by handshakers).
 /// If non-null, \a notify_on_receive_settings will be scheduled when
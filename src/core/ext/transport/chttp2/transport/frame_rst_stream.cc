@@ -105,7 +105,11 @@ grpc_error* grpc_chttp2_rst_stream_parser_parse(void* parser,
                       ((static_cast<uint32_t>(p->reason_bytes[2])) << 8) |
                       ((static_cast<uint32_t>(p->reason_bytes[3])));
     grpc_error* error = GRPC_ERROR_NONE;
-    if (reason != GRPC_HTTP2_NO_ERROR || s->metadata_buffer[1].size == 0) {
+    if (reason == GRPC_HTTP2_CANCEL) {
+      // By far the most common reason: avoid allocating an error for it.
+      error = GRPC_ERROR_RST_STREAM_CANCEL;
+    } else if (reason != GRPC_HTTP2_NO_ERROR ||
+               s->metadata_buffer[1].size == 0) {
       error = grpc_error_set_int(
           grpc_error_set_str(
               GRPC_ERROR_CREATE_FROM_STATIC_STRING("RST_STREAM"),
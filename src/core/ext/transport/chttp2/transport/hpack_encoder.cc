@@ -242,20 +242,36 @@ static void IncrementFilter(uint8_t idx, uint32_t* sum, uint8_t* elems) {
   }
 }
 
-static uint32_t UpdateHashtablePopularity(
+/* the cell of each filter row that a hash maps to; the cuckoo tables use
+   fragments 2 and 3, leaving 1 and 4 for the filter */
+struct PopularityHash {
+  uint8_t cells[GRPC_CHTTP2_HPACKC_FILTER_ROWS];
+};
+static_assert(GRPC_CHTTP2_HPACKC_FILTER_ROWS == 2,
+              "PopularityHash only knows about two hash fragments");
+
+static PopularityHash UpdateHashtablePopularity(
     grpc_chttp2_hpack_compressor* hpack_compressor, uint32_t elem_hash) {
-  const uint32_t popularity_hash = HASH_FRAGMENT_1(elem_hash);
-  IncrementFilter(popularity_hash, &hpack_compressor->filter_elems_sum,
-                  hpack_compressor->filter_elems);
+  const PopularityHash popularity_hash = {
+      {static_cast<uint8_t>(HASH_FRAGMENT_1(elem_hash)),
+       static_cast<uint8_t>(HASH_FRAGMENT_4(elem_hash))}};
+  for (int row = 0; row < GRPC_CHTTP2_HPACKC_FILTER_ROWS; row++) {
+    IncrementFilter(popularity_hash.cells[row],
+                    &hpack_compressor->filter_elems_sum[row],
+                    hpack_compressor->filter_elems[row]);
+  }
   return popularity_hash;
 }
 
 static bool CanAddToHashtable(grpc_chttp2_hpack_compressor* hpack_compressor,
-                              uint32_t popularity_hash) {
-  const bool can_add =
-      hpack_compressor->filter_elems[popularity_hash] >=
-      hpack_compressor->filter_elems_sum / ONE_ON_ADD_PROBABILITY;
-  return can_add;
+                              const PopularityHash& popularity_hash) {
+  for (int row = 0; row < GRPC_CHTTP2_HPACKC_FILTER_ROWS; row++) {
+    if (hpack_compressor->filter_elems[row][popularity_hash.cells[row]] <
+        hpack_compressor->filter_elems_sum[row] / ONE_ON_ADD_PROBABILITY) {
+      return false;
+    }
+  }
+  return true;
 }
 } /* namespace */
 
@@ -274,6 +290,8 @@ struct framer_state {
   uint32_t stream_id;
   grpc_slice_buffer* output;
   grpc_transport_one_way_stats* stats;
+  /* size of the headers encoded so far, before encoding */
+  uint64_t uncompressed_bytes;
   /* maximum size of a frame */
   size_t max_frame_size;
   bool use_true_binary_metadata;
@@ -648,7 +666,8 @@ static EmitIndexedStatus maybe_emit_indexed(grpc_chttp2_hpack_compressor* c,
           : reinterpret_cast<grpc_core::StaticMetadata*>(GRPC_MDELEM_DATA(elem))
                 ->hash();
   /* Update filter to see if we can perhaps add this elem. */
-  const uint32_t popularity_hash = UpdateHashtablePopularity(c, elem_hash);
+  const PopularityHash popularity_hash =
+      UpdateHashtablePopularity(c, elem_hash);
   /* is this elem currently in the decoders table? */
   HpackEncoderIndex indices_key;
   if (GetMatchingIndex<MetadataComparator>(c->elem_table.entries, elem,
@@ -741,6 +760,11 @@ static void hpack_enc(grpc_chttp2_hpack_compressor* c, grpc_mdelem elem,
   }
 }
 
+static void count_uncompressed(framer_state* st, grpc_mdelem elem) {
+  st->uncompressed_bytes += GRPC_SLICE_LENGTH(GRPC_MDKEY(elem)) +
+                            GRPC_SLICE_LENGTH(GRPC_MDVALUE(elem));
+}
+
 #define STRLEN_LIT(x) (sizeof(x) - 1)
 #define TIMEOUT_KEY "grpc-timeout"
 
@@ -752,6 +776,7 @@ static void deadline_enc(grpc_chttp2_hpack_compressor* c, grpc_millis deadline,
                             timeout_str);
   mdelem = grpc_mdelem_from_slices(
       GRPC_MDSTR_GRPC_TIMEOUT, grpc_core::UnmanagedMemorySlice(timeout_str));
+  count_uncompressed(st, mdelem);
   hpack_enc(c, mdelem, st);
   GRPC_MDELEM_UNREF(mdelem);
 }
@@ -851,6 +876,7 @@ void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
   st.output = outbuf;
   st.is_first_frame = 1;
   st.stats = options->stats;
+  st.uncompressed_bytes = 0;
   st.max_frame_size = options->max_frame_size;
   st.use_true_binary_metadata = options->use_true_binary_metadata;
   st.is_end_of_stream = options->is_eof;
@@ -865,6 +891,7 @@ void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
   }
   for (size_t i = 0; i < extra_headers_size; ++i) {
     grpc_mdelem md = *extra_headers[i];
+    count_uncompressed(&st, md);
     const bool is_static =
         GRPC_MDELEM_STORAGE(md) == GRPC_MDELEM_STORAGE_STATIC;
     uintptr_t static_index;
@@ -879,6 +906,7 @@ void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
   }
   grpc_metadata_batch_assert_ok(metadata);
   for (grpc_linked_mdelem* l = metadata->list.head; l; l = l->next) {
+    count_uncompressed(&st, l->md);
     const bool is_static =
         GRPC_MDELEM_STORAGE(l->md) == GRPC_MDELEM_STORAGE_STATIC;
     uintptr_t static_index;
@@ -897,4 +925,7 @@ void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
   }
 
   finish_frame(&st, 1);
+  if (options->uncompressed_header_bytes != nullptr) {
+    *options->uncompressed_header_bytes += st.uncompressed_bytes;
+  }
 }
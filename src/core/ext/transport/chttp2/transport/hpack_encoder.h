@@ -35,6 +35,8 @@
 #define GRPC_CHTTP2_HPACKC_INITIAL_TABLE_SIZE 4096
 /* maximum table size we'll actually use */
 #define GRPC_CHTTP2_HPACKC_MAX_TABLE_SIZE (1024 * 1024)
+/* number of independently hashed rows in the popularity filter */
+#define GRPC_CHTTP2_HPACKC_FILTER_ROWS 2
 
 extern grpc_core::TraceFlag grpc_http_trace;
 
@@ -54,13 +56,17 @@ struct grpc_chttp2_hpack_compressor {
       of this size */
   uint8_t advertise_table_size_change;
 
-  /* filter tables for elems: this tables provides an approximate
-     popularity count for particular hashes, and are used to determine whether
-     a new literal should be added to the compression table or not.
-     They track a single integer that counts how often a particular value has
-     been seen. When that count reaches max (255), all values are halved. */
-  uint32_t filter_elems_sum;
-  uint8_t filter_elems[GRPC_CHTTP2_HPACKC_NUM_VALUES];
+  /* filter tables for elems: a count-min sketch providing an approximate
+     popularity count for particular hashes, used to determine whether a new
+     literal should be added to the compression table or not.
+     Each row counts how often values hashing to each of its cells have been
+     seen, using a different fragment of the hash per row; a value's count is
+     the smallest of its cells, so that it is only overestimated if it
+     collides with a popular value in every row. When a cell reaches max (255),
+     all of its row's values are halved. */
+  uint32_t filter_elems_sum[GRPC_CHTTP2_HPACKC_FILTER_ROWS];
+  uint8_t filter_elems[GRPC_CHTTP2_HPACKC_FILTER_ROWS]
+                      [GRPC_CHTTP2_HPACKC_NUM_VALUES];
 
   /* entry tables for keys & elems: these tables track values that have been
      seen and *may* be in the decompressor table */
@@ -96,6 +102,9 @@ struct grpc_encode_header_options {
   bool use_true_binary_metadata;
   size_t max_frame_size;
   grpc_transport_one_way_stats* stats;
+  /* if non-null, incremented by the size of the headers before encoding
+     (the sum of their key and value lengths) */
+  uint64_t* uncompressed_header_bytes;
 };
 void grpc_chttp2_encode_header(grpc_chttp2_hpack_compressor* c,
                                grpc_mdelem** extra_headers,
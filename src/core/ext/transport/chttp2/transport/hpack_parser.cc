@@ -30,6 +30,7 @@
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/sync.h>
 
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/lib/debug/stats.h"
@@ -1417,32 +1418,67 @@ static grpc_error* finish_str(grpc_chttp2_hpack_parser* p, const uint8_t* cur,
   return GRPC_ERROR_NONE;
 }
 
-/* decode a nibble from a huffman encoded stream */
-static grpc_error* huff_nibble(grpc_chttp2_hpack_parser* p, uint8_t nibble) {
-  int16_t emit = emit_sub_tbl[16 * emit_tbl[p->huff_state] + nibble];
-  int16_t next = next_sub_tbl[16 * next_tbl[p->huff_state] + nibble];
-  if (emit != -1) {
-    if (emit >= 0 && emit < 256) {
-      uint8_t c = static_cast<uint8_t>(emit);
-      grpc_error* err = append_string(p, &c, (&c) + 1);
-      if (err != GRPC_ERROR_NONE) return err;
-    } else {
-      assert(emit == 256);
+/* byte-at-a-time huffman decoding: the result of running the nibble state
+   machine above over both halves of each byte, for every (state, byte) pair.
+   No huffman code is shorter than five bits, so a nibble completes at most one
+   symbol and a byte at most two. EOS (256) is dropped here, as it always has
+   been. Built once by grpc_chttp2_hpack_parser_init. */
+typedef struct {
+  uint8_t next_state;
+  uint8_t emit_count;
+  uint8_t emit[2];
+} huff_byte_step;
+
+static huff_byte_step g_huff_byte_tbl[256 * 256];
+static gpr_once g_huff_byte_tbl_once = GPR_ONCE_INIT;
+
+static int16_t huff_nibble_step(int16_t state, uint8_t nibble,
+                                huff_byte_step* step) {
+  int16_t emit = emit_sub_tbl[16 * emit_tbl[state] + nibble];
+  if (emit >= 0 && emit < 256) {
+    step->emit[step->emit_count++] = static_cast<uint8_t>(emit);
+  } else {
+    GPR_DEBUG_ASSERT(emit == -1 || emit == 256);
+  }
+  return next_sub_tbl[16 * next_tbl[state] + nibble];
+}
+
+static void build_huff_byte_tbl(void) {
+  for (int16_t state = 0; state < 256; state++) {
+    for (int byte = 0; byte < 256; byte++) {
+      huff_byte_step* step = &g_huff_byte_tbl[state * 256 + byte];
+      int16_t next =
+          huff_nibble_step(state, static_cast<uint8_t>(byte >> 4), step);
+      next = huff_nibble_step(next, static_cast<uint8_t>(byte & 0xf), step);
+      GPR_ASSERT(next >= 0 && next < 256);
+      step->next_state = static_cast<uint8_t>(next);
     }
   }
-  p->huff_state = next;
-  return GRPC_ERROR_NONE;
 }
 
 /* decode full bytes from a huffman encoded stream */
 static grpc_error* add_huff_bytes(grpc_chttp2_hpack_parser* p,
                                   const uint8_t* cur, const uint8_t* end) {
+  /* decoded symbols are collected here and passed to append_string in runs,
+     rather than one call per symbol */
+  uint8_t decoded[256];
+  size_t decoded_length = 0;
+  int16_t state = p->huff_state;
   for (; cur != end; ++cur) {
-    grpc_error* err = huff_nibble(p, *cur >> 4);
-    if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
-    err = huff_nibble(p, *cur & 0xf);
-    if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
+    const huff_byte_step& step = g_huff_byte_tbl[state * 256 + *cur];
+    decoded[decoded_length] = step.emit[0];
+    decoded[decoded_length + 1] = step.emit[1];
+    decoded_length += step.emit_count;
+    state = step.next_state;
+    if (decoded_length > sizeof(decoded) - 2) {
+      grpc_error* err = append_string(p, decoded, decoded + decoded_length);
+      if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
+      decoded_length = 0;
+    }
   }
+  p->huff_state = state;
+  grpc_error* err = append_string(p, decoded, decoded + decoded_length);
+  if (err != GRPC_ERROR_NONE) return parse_error(p, cur, end, err);
   return GRPC_ERROR_NONE;
 }
 
@@ -1604,6 +1640,7 @@ static grpc_error* on_header_uninitialized(void* /*user_data*/,
 /* PUBLIC INTERFACE */
 
 void grpc_chttp2_hpack_parser_init(grpc_chttp2_hpack_parser* p) {
+  gpr_once_init(&g_huff_byte_tbl_once, build_huff_byte_tbl);
   p->on_header = on_header_uninitialized;
   p->on_header_user_data = nullptr;
   p->state = parse_begin;
@@ -356,6 +356,21 @@ struct grpc_chttp2_transport {
    */
   uint32_t write_buffer_size = grpc_core::chttp2::kDefaultWindow;
 
+  /* write coalescing support */
+  /** how long a write started by an RPC is held back for others to join it
+      (0 disables coalescing) */
+  grpc_millis write_coalescing_window = 0;
+  /** flush the held back write once this many message bytes are queued */
+  uint32_t write_coalescing_max_bytes = 64 * 1024;
+  /** message bytes queued since the held back write was started */
+  size_t write_coalescing_bytes = 0;
+  /** is a write being held back for the coalescing window? */
+  bool write_coalescing_timer_pending = false;
+  /** timer ending the coalescing window */
+  grpc_timer write_coalescing_timer;
+  /** closure run when the coalescing window ends */
+  grpc_closure write_coalescing_done_locked;
+
   /** Set to a grpc_error object if a goaway frame is received. By default, set
    * to GRPC_ERROR_NONE */
   grpc_error* goaway_error = GRPC_ERROR_NONE;
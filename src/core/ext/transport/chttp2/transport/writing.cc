@@ -211,6 +211,9 @@ class WriteContext {
     GRPC_STATS_INC_HTTP2_SEND_TRAILING_METADATA_PER_WRITE(
         trailing_metadata_writes_);
     GRPC_STATS_INC_HTTP2_SEND_FLOWCTL_PER_WRITE(flow_control_writes_);
+    GRPC_STATS_INC_HTTP2_FRAMES_PER_WRITE(
+        initial_metadata_writes_ + message_writes_ +
+        trailing_metadata_writes_ + flow_control_writes_);
   }
 
   void FlushSettings() {
@@ -453,6 +456,8 @@ class StreamWriteContext {
         is_default_initial_metadata(s_->send_initial_metadata)) {
       ConvertInitialMetadataToTrailingMetadata();
     } else {
+      uint64_t uncompressed_header_bytes = 0;
+      const uint64_t header_bytes_before = s_->stats.outgoing.header_bytes;
       grpc_encode_header_options hopt = {
           s_->id,  // stream_id
           false,   // is_eof
@@ -461,10 +466,12 @@ class StreamWriteContext {
               0,  // use_true_binary_metadata
           t_->settings[GRPC_PEER_SETTINGS]
                       [GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],  // max_frame_size
-          &s_->stats.outgoing                                 // stats
+          &s_->stats.outgoing,                                // stats
+          &uncompressed_header_bytes  // uncompressed_header_bytes
       };
       grpc_chttp2_encode_header(&t_->hpack_compressor, nullptr, 0,
                                 s_->send_initial_metadata, &hopt, &t_->outbuf);
+      RecordHeadersEncoded(uncompressed_header_bytes, header_bytes_before);
       grpc_chttp2_reset_ping_clock(t_);
       write_context_->IncInitialMetadataWrites();
     }
@@ -561,6 +568,8 @@ class StreamWriteContext {
       grpc_chttp2_encode_data(s_->id, &s_->flow_controlled_buffer, 0, true,
                               &s_->stats.outgoing, &t_->outbuf);
     } else {
+      uint64_t uncompressed_header_bytes = 0;
+      const uint64_t header_bytes_before = s_->stats.outgoing.header_bytes;
       grpc_encode_header_options hopt = {
           s_->id, true,
           t_->settings[GRPC_PEER_SETTINGS]
@@ -568,11 +577,12 @@ class StreamWriteContext {
               0,
 
           t_->settings[GRPC_PEER_SETTINGS][GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE],
-          &s_->stats.outgoing};
+          &s_->stats.outgoing, &uncompressed_header_bytes};
       grpc_chttp2_encode_header(&t_->hpack_compressor,
                                 extra_headers_for_trailing_metadata_,
                                 num_extra_headers_for_trailing_metadata_,
                                 s_->send_trailing_metadata, &hopt, &t_->outbuf);
+      RecordHeadersEncoded(uncompressed_header_bytes, header_bytes_before);
     }
     write_context_->IncTrailingMetadataWrites();
     grpc_chttp2_reset_ping_clock(t_);
@@ -587,6 +597,16 @@ class StreamWriteContext {
   bool stream_became_writable() { return stream_became_writable_; }
 
  private:
+  // Reports how well the headers just encoded for this stream compressed.
+  void RecordHeadersEncoded(uint64_t uncompressed_header_bytes,
+                            uint64_t header_bytes_before) {
+    if (t_->channelz_socket != nullptr) {
+      t_->channelz_socket->RecordHeadersEncoded(
+          uncompressed_header_bytes,
+          s_->stats.outgoing.header_bytes - header_bytes_before);
+    }
+  }
+
   void ConvertInitialMetadataToTrailingMetadata() {
     GRPC_CHTTP2_IF_TRACING(
         gpr_log(GPR_INFO, "not sending initial_metadata (Trailers-Only)"));
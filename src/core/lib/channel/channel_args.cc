@@ -34,6 +34,7 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gpr/murmur_hash.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
 
@@ -233,6 +234,32 @@ int grpc_channel_args_compare(const grpc_channel_args* a,
   return 0;
 }
 
+static uint32_t hash_arg(const grpc_arg* arg, uint32_t seed) {
+  uint32_t h = gpr_murmur_hash3(&arg->type, sizeof(arg->type), seed);
+  h = gpr_murmur_hash3(arg->key, strlen(arg->key), h);
+  switch (arg->type) {
+    case GRPC_ARG_STRING:
+      return gpr_murmur_hash3(arg->value.string, strlen(arg->value.string), h);
+    case GRPC_ARG_INTEGER:
+      return gpr_murmur_hash3(&arg->value.integer, sizeof(arg->value.integer),
+                              h);
+    case GRPC_ARG_POINTER:
+      // cmp_arg() may consider distinct pointers (or even vtables) equal, so
+      // a pointer arg can only contribute its type and key.
+      return h;
+  }
+  GPR_UNREACHABLE_CODE(return h);
+}
+
+size_t grpc_channel_args_hash(const grpc_channel_args* args) {
+  if (args == nullptr) return 0;
+  uint32_t h = gpr_murmur_hash3(&args->num_args, sizeof(args->num_args), 0);
+  for (size_t i = 0; i < args->num_args; i++) {
+    h = hash_arg(&args->args[i], h);
+  }
+  return h;
+}
+
 const grpc_arg* grpc_channel_args_find(const grpc_channel_args* args,
                                        const char* name) {
   if (args != nullptr) {
@@ -549,6 +549,24 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = std::to_string(keepalives_sent);
   }
+  // HPACK header compression is reported as socket options, since the proto
+  // has no dedicated fields for it.
+  int64_t header_bytes_uncompressed =
+      header_bytes_uncompressed_.Load(MemoryOrder::RELAXED);
+  if (header_bytes_uncompressed != 0) {
+    int64_t header_bytes_encoded =
+        header_bytes_encoded_.Load(MemoryOrder::RELAXED);
+    data["option"] = Json::Array{
+        Json::Object{
+            {"name", "grpc.hpack.header_bytes_uncompressed"},
+            {"value", std::to_string(header_bytes_uncompressed)},
+        },
+        Json::Object{
+            {"name", "grpc.hpack.header_bytes_encoded"},
+            {"value", std::to_string(header_bytes_encoded)},
+        },
+    };
+  }
   // Create and fill the parent object.
   Json::Object object = {
       {"ref",
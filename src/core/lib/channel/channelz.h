@@ -317,6 +317,14 @@ class SocketNode : public BaseNode {
   void RecordKeepaliveSent() {
     keepalives_sent_.FetchAdd(1, MemoryOrder::RELAXED);
   }
+  // Records a header block that took \a uncompressed_bytes before and
+  // \a encoded_bytes after HPACK encoding.
+  void RecordHeadersEncoded(uint64_t uncompressed_bytes,
+                            uint64_t encoded_bytes) {
+    header_bytes_uncompressed_.FetchAdd(uncompressed_bytes,
+                                        MemoryOrder::RELAXED);
+    header_bytes_encoded_.FetchAdd(encoded_bytes, MemoryOrder::RELAXED);
+  }
 
   const std::string& remote() { return remote_; }
 
@@ -327,6 +335,8 @@ class SocketNode : public BaseNode {
   Atomic<int64_t> messages_sent_{0};
   Atomic<int64_t> messages_received_{0};
   Atomic<int64_t> keepalives_sent_{0};
+  Atomic<int64_t> header_bytes_uncompressed_{0};
+  Atomic<int64_t> header_bytes_encoded_{0};
   Atomic<gpr_cycle_counter> last_local_stream_created_cycle_{0};
   Atomic<gpr_cycle_counter> last_remote_stream_created_cycle_{0};
   Atomic<gpr_cycle_counter> last_message_sent_cycle_{0};
@@ -43,6 +43,13 @@ grpc_mdelem grpc_compression_encoding_mdelem(
 grpc_mdelem grpc_message_compression_encoding_mdelem(
     grpc_message_compression_algorithm algorithm);
 
+/** Return the grpc-accept-encoding metadata element advertising the message
+ * compression algorithms in \a message_bitset. Bitsets only made of the zlib
+ * based algorithms map onto static metadata; the others are interned, and the
+ * caller owns the returned reference. */
+grpc_mdelem grpc_message_compression_accept_encoding_mdelem(
+    uint32_t message_bitset);
+
 /** Return stream compression algorithm based metadata element
  * (content-encoding: xxx) */
 grpc_mdelem grpc_stream_compression_encoding_mdelem(
@@ -32,7 +32,9 @@
 
 int grpc_compression_algorithm_is_message(
     grpc_compression_algorithm algorithm) {
-  return (algorithm >= GRPC_COMPRESS_DEFLATE && algorithm <= GRPC_COMPRESS_GZIP)
+  return ((algorithm >= GRPC_COMPRESS_DEFLATE &&
+           algorithm <= GRPC_COMPRESS_GZIP) ||
+          (algorithm >= GRPC_COMPRESS_ZSTD && algorithm <= GRPC_COMPRESS_LZ4))
              ? 1
              : 0;
 }
@@ -52,6 +54,12 @@ int grpc_compression_algorithm_parse(grpc_slice name,
   } else if (grpc_slice_eq_static_interned(name, GRPC_MDSTR_GZIP)) {
     *algorithm = GRPC_COMPRESS_GZIP;
     return 1;
+  } else if (grpc_slice_str_cmp(name, "zstd") == 0) {
+    *algorithm = GRPC_COMPRESS_ZSTD;
+    return 1;
+  } else if (grpc_slice_str_cmp(name, "lz4") == 0) {
+    *algorithm = GRPC_COMPRESS_LZ4;
+    return 1;
   } else if (grpc_slice_eq_static_interned(name,
                                            GRPC_MDSTR_STREAM_SLASH_GZIP)) {
     *algorithm = GRPC_COMPRESS_STREAM_GZIP;
@@ -75,6 +83,12 @@ int grpc_compression_algorithm_name(grpc_compression_algorithm algorithm,
     case GRPC_COMPRESS_GZIP:
       *name = "gzip";
       return 1;
+    case GRPC_COMPRESS_ZSTD:
+      *name = "zstd";
+      return 1;
+    case GRPC_COMPRESS_LZ4:
+      *name = "lz4";
+      return 1;
     case GRPC_COMPRESS_STREAM_GZIP:
       *name = "stream/gzip";
       return 1;
@@ -140,6 +154,10 @@ grpc_slice grpc_compression_algorithm_slice(
       return GRPC_MDSTR_DEFLATE;
     case GRPC_COMPRESS_GZIP:
       return GRPC_MDSTR_GZIP;
+    case GRPC_COMPRESS_ZSTD:
+      return grpc_slice_from_static_string("zstd");
+    case GRPC_COMPRESS_LZ4:
+      return grpc_slice_from_static_string("lz4");
     case GRPC_COMPRESS_STREAM_GZIP:
       return GRPC_MDSTR_STREAM_SLASH_GZIP;
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
@@ -159,6 +177,12 @@ grpc_compression_algorithm grpc_compression_algorithm_from_slice(
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_GZIP)) {
     return GRPC_COMPRESS_GZIP;
   }
+  if (grpc_slice_str_cmp(str, "zstd") == 0) {
+    return GRPC_COMPRESS_ZSTD;
+  }
+  if (grpc_slice_str_cmp(str, "lz4") == 0) {
+    return GRPC_COMPRESS_LZ4;
+  }
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_STREAM_SLASH_GZIP)) {
     return GRPC_COMPRESS_STREAM_GZIP;
   }
@@ -174,6 +198,11 @@ grpc_mdelem grpc_compression_encoding_mdelem(
       return GRPC_MDELEM_GRPC_ENCODING_DEFLATE;
     case GRPC_COMPRESS_GZIP:
       return GRPC_MDELEM_GRPC_ENCODING_GZIP;
+    case GRPC_COMPRESS_ZSTD:
+    case GRPC_COMPRESS_LZ4:
+      return grpc_message_compression_encoding_mdelem(
+          grpc_compression_algorithm_to_message_compression_algorithm(
+              algorithm));
     case GRPC_COMPRESS_STREAM_GZIP:
       return GRPC_MDELEM_GRPC_ENCODING_GZIP;
     default:
@@ -29,8 +29,11 @@
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/compression/compression_args.h"
+#include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/iomgr/load_file.h"
+#include "src/core/lib/slice/slice_internal.h"
 
 grpc_compression_algorithm
 grpc_channel_args_get_channel_default_compression_algorithm(
@@ -133,3 +136,73 @@ uint32_t grpc_channel_args_compression_algorithm_get_states(
     return (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1; /* All algs. enabled */
   }
 }
+
+namespace grpc_core {
+
+CompressionDictionary::CompressionDictionary(grpc_slice data)
+    : data_(data), id_(grpc_msg_compression_dictionary_id(data)) {}
+
+CompressionDictionary::~CompressionDictionary() {
+  grpc_slice_unref_internal(data_);
+}
+
+namespace {
+
+void* DictionaryArgCopy(void* p) {
+  CompressionDictionary* dictionary = static_cast<CompressionDictionary*>(p);
+  return dictionary->Ref().release();
+}
+
+void DictionaryArgDestroy(void* p) {
+  CompressionDictionary* dictionary = static_cast<CompressionDictionary*>(p);
+  dictionary->Unref();
+}
+
+int DictionaryArgCmp(void* p, void* q) { return GPR_ICMP(p, q); }
+
+const grpc_arg_pointer_vtable kChannelArgVtable = {
+    DictionaryArgCopy, DictionaryArgDestroy, DictionaryArgCmp};
+
+}  // namespace
+
+grpc_arg CompressionDictionary::MakeChannelArg() const {
+  return grpc_channel_arg_pointer_create(
+      const_cast<char*>(GRPC_ARG_COMPRESSION_DICTIONARY),
+      const_cast<CompressionDictionary*>(this), &kChannelArgVtable);
+}
+
+RefCountedPtr<CompressionDictionary> CompressionDictionary::GetFromChannelArgs(
+    const grpc_channel_args* args) {
+  CompressionDictionary* dictionary =
+      grpc_channel_args_find_pointer<CompressionDictionary>(
+          args, GRPC_ARG_COMPRESSION_DICTIONARY);
+  return dictionary != nullptr ? dictionary->Ref() : nullptr;
+}
+
+}  // namespace grpc_core
+
+grpc_channel_args* grpc_channel_args_load_compression_dictionary(
+    const grpc_channel_args* a) {
+  if (grpc_channel_args_find(a, GRPC_ARG_COMPRESSION_DICTIONARY) != nullptr) {
+    return nullptr;
+  }
+  const char* path = grpc_channel_args_find_string(
+      a, GRPC_COMPRESSION_CHANNEL_DICTIONARY_FILE);
+  if (path == nullptr) return nullptr;
+  grpc_slice data;
+  grpc_error* error = grpc_load_file(path, 0, &data);
+  if (error != GRPC_ERROR_NONE) {
+    gpr_log(GPR_ERROR, "Could not load compression dictionary: %s",
+            grpc_error_string(error));
+    GRPC_ERROR_UNREF(error);
+    return nullptr;
+  }
+  if (GRPC_SLICE_LENGTH(data) == 0) {
+    grpc_slice_unref_internal(data);
+    return nullptr;
+  }
+  auto dictionary =
+      grpc_core::MakeRefCounted<grpc_core::CompressionDictionary>(data);
+  grpc_arg arg = dictionary->MakeChannelArg();
+  return grpc_channel_args_copy_and_add(a, &arg, 1);
+}
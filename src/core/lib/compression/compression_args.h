@@ -24,6 +24,9 @@
 #include <grpc/compression.h>
 #include <grpc/impl/codegen/grpc_types.h>
 
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+
 /** Returns the compression algorithm set in \a a. */
 grpc_compression_algorithm
 grpc_channel_args_get_channel_default_compression_algorithm(
@@ -53,4 +56,41 @@ grpc_channel_args* grpc_channel_args_compression_algorithm_set_state(
 uint32_t grpc_channel_args_compression_algorithm_get_states(
     const grpc_channel_args* a);
 
+/** Channel arg carrying the preset dictionary loaded from
+ * GRPC_COMPRESSION_CHANNEL_DICTIONARY_FILE. Its value is a pointer to a
+ * grpc_core::CompressionDictionary. */
+#define GRPC_ARG_COMPRESSION_DICTIONARY "grpc.internal.compression_dictionary"
+
+namespace grpc_core {
+
+// A preset compression dictionary, loaded once per channel and shared through
+// channel args by the message compress and decompress filters.
+class CompressionDictionary : public RefCounted<CompressionDictionary> {
+ public:
+  // Takes ownership of \a data.
+  explicit CompressionDictionary(grpc_slice data);
+  ~CompressionDictionary() override;
+
+  const grpc_slice& data() const { return data_; }
+  // Adler-32 of the dictionary, as recorded by zlib.
+  uint32_t id() const { return id_; }
+
+  grpc_arg MakeChannelArg() const;
+  static RefCountedPtr<CompressionDictionary> GetFromChannelArgs(
+      const grpc_channel_args* args);
+
+ private:
+  grpc_slice data_;
+  uint32_t id_;
+};
+
+}  // namespace grpc_core
+
+/** If \a a names a dictionary file but does not carry a loaded dictionary yet,
+ * returns a copy of \a a with the file's contents added as
+ * GRPC_ARG_COMPRESSION_DICTIONARY. Returns NULL if there is nothing to load or
+ * the file cannot be read. */
+grpc_channel_args* grpc_channel_args_load_compression_dictionary(
+    const grpc_channel_args* a);
+
 #endif /* GRPC_CORE_LIB_COMPRESSION_COMPRESSION_ARGS_H */
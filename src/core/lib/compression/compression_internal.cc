@@ -21,6 +21,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_join.h"
+
 #include <grpc/compression.h>
 
 #include "src/core/lib/compression/algorithm_metadata.h"
@@ -43,6 +48,12 @@ grpc_message_compression_algorithm_from_slice(const grpc_slice& str) {
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_GZIP)) {
     return GRPC_MESSAGE_COMPRESS_GZIP;
   }
+  if (grpc_slice_str_cmp(str, "zstd") == 0) {
+    return GRPC_MESSAGE_COMPRESS_ZSTD;
+  }
+  if (grpc_slice_str_cmp(str, "lz4") == 0) {
+    return GRPC_MESSAGE_COMPRESS_LZ4;
+  }
   return GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT;
 }
 
@@ -66,12 +77,41 @@ grpc_mdelem grpc_message_compression_encoding_mdelem(
       return GRPC_MDELEM_GRPC_ENCODING_DEFLATE;
     case GRPC_MESSAGE_COMPRESS_GZIP:
       return GRPC_MDELEM_GRPC_ENCODING_GZIP;
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+      return grpc_mdelem_from_slices(GRPC_MDSTR_GRPC_ENCODING,
+                                     grpc_core::ManagedMemorySlice("zstd"));
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      return grpc_mdelem_from_slices(GRPC_MDSTR_GRPC_ENCODING,
+                                     grpc_core::ManagedMemorySlice("lz4"));
     default:
       break;
   }
   return GRPC_MDNULL;
 }
 
+grpc_mdelem grpc_message_compression_accept_encoding_mdelem(
+    uint32_t message_bitset) {
+  message_bitset |= 1u << GRPC_MESSAGE_COMPRESS_NONE;
+  if (message_bitset < (1u << (GRPC_MESSAGE_COMPRESS_GZIP + 1))) {
+    return GRPC_MDELEM_ACCEPT_ENCODING_FOR_ALGORITHMS(message_bitset);
+  }
+  /* The static table only covers the zlib based algorithms: spell out the
+   * value and intern it instead. */
+  std::vector<const char*> names;
+  for (int i = 0; i < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; i++) {
+    const char* name;
+    if (GPR_BITGET(message_bitset, i) &&
+        grpc_message_compression_algorithm_name(
+            static_cast<grpc_message_compression_algorithm>(i), &name)) {
+      names.push_back(name);
+    }
+  }
+  std::string value = absl::StrJoin(names, ",");
+  return grpc_mdelem_from_slices(
+      GRPC_MDSTR_GRPC_ACCEPT_ENCODING,
+      grpc_core::ManagedMemorySlice(value.data(), value.size()));
+}
+
 grpc_mdelem grpc_stream_compression_encoding_mdelem(
     grpc_stream_compression_algorithm algorithm) {
   switch (algorithm) {
@@ -95,6 +135,10 @@ grpc_compression_algorithm_to_message_compression_algorithm(
       return GRPC_MESSAGE_COMPRESS_DEFLATE;
     case GRPC_COMPRESS_GZIP:
       return GRPC_MESSAGE_COMPRESS_GZIP;
+    case GRPC_COMPRESS_ZSTD:
+      return GRPC_MESSAGE_COMPRESS_ZSTD;
+    case GRPC_COMPRESS_LZ4:
+      return GRPC_MESSAGE_COMPRESS_LZ4;
     default:
       return GRPC_MESSAGE_COMPRESS_NONE;
   }
@@ -111,14 +155,34 @@ grpc_compression_algorithm_to_stream_compression_algorithm(
   }
 }
 
+/* The message algorithms that predate stream compression share their bits in
+ * grpc_compression_algorithm bitsets with grpc_message_compression_algorithm
+ * bitsets. The later ones come after GRPC_COMPRESS_STREAM_GZIP in the former
+ * and right after GRPC_MESSAGE_COMPRESS_GZIP in the latter. */
+#define GRPC_LEGACY_MESSAGE_BITS ((1u << GRPC_MESSAGE_COMPRESS_ZSTD) - 1)
+
 uint32_t grpc_compression_bitset_to_message_bitset(uint32_t bitset) {
-  return bitset & ((1u << GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT) - 1);
+  uint32_t later_bits = (bitset >> GRPC_COMPRESS_ZSTD)
+                        << GRPC_MESSAGE_COMPRESS_ZSTD;
+  return ((bitset & GRPC_LEGACY_MESSAGE_BITS) | later_bits) &
+         ((1u << GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT) - 1);
+}
+
+uint32_t grpc_compression_algorithms_available_bitset(void) {
+  uint32_t bitset = (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
+#ifndef GRPC_HAVE_ZSTD
+  GPR_BITCLEAR(&bitset, GRPC_COMPRESS_ZSTD);
+#endif
+#ifndef GRPC_HAVE_LZ4
+  GPR_BITCLEAR(&bitset, GRPC_COMPRESS_LZ4);
+#endif
+  return bitset;
 }
 
 uint32_t grpc_compression_bitset_to_stream_bitset(uint32_t bitset) {
   uint32_t identity = (bitset & 1u);
   uint32_t other_bits =
-      (bitset >> (GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT - 1)) &
+      (bitset >> (GRPC_COMPRESS_STREAM_GZIP - GRPC_STREAM_COMPRESS_GZIP)) &
       ((1u << GRPC_STREAM_COMPRESS_ALGORITHMS_COUNT) - 2);
   return identity | other_bits;
 }
@@ -127,8 +191,12 @@ uint32_t grpc_compression_bitset_from_message_stream_compression_bitset(
     uint32_t message_bitset, uint32_t stream_bitset) {
   uint32_t offset_stream_bitset =
       (stream_bitset & 1u) |
-      ((stream_bitset & (~1u)) << (GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT - 1));
-  return message_bitset | offset_stream_bitset;
+      ((stream_bitset & (~1u))
+       << (GRPC_COMPRESS_STREAM_GZIP - GRPC_STREAM_COMPRESS_GZIP));
+  uint32_t offset_message_bitset =
+      (message_bitset & GRPC_LEGACY_MESSAGE_BITS) |
+      ((message_bitset >> GRPC_MESSAGE_COMPRESS_ZSTD) << GRPC_COMPRESS_ZSTD);
+  return offset_message_bitset | offset_stream_bitset;
 }
 
 int grpc_compression_algorithm_from_message_stream_compression_algorithm(
@@ -163,6 +231,12 @@ int grpc_compression_algorithm_from_message_stream_compression_algorithm(
       case GRPC_MESSAGE_COMPRESS_GZIP:
         *algorithm = GRPC_COMPRESS_GZIP;
         return 1;
+      case GRPC_MESSAGE_COMPRESS_ZSTD:
+        *algorithm = GRPC_COMPRESS_ZSTD;
+        return 1;
+      case GRPC_MESSAGE_COMPRESS_LZ4:
+        *algorithm = GRPC_COMPRESS_LZ4;
+        return 1;
       default:
         *algorithm = GRPC_COMPRESS_NONE;
         return 0;
@@ -188,6 +262,12 @@ int grpc_message_compression_algorithm_name(
     case GRPC_MESSAGE_COMPRESS_GZIP:
       *name = "gzip";
       return 1;
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+      *name = "zstd";
+      return 1;
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      *name = "lz4";
+      return 1;
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       return 0;
   }
@@ -206,6 +286,11 @@ grpc_message_compression_algorithm grpc_message_compression_algorithm_for_level(
     abort();
   }
 
+  /* Never pick an algorithm this build can't compress with, even if the peer
+   * accepts it. */
+  accepted_encodings &= grpc_compression_bitset_to_message_bitset(
+      grpc_compression_algorithms_available_bitset());
+  accepted_encodings |= 1u << GRPC_MESSAGE_COMPRESS_NONE;
   const size_t num_supported =
       GPR_BITCOUNT(accepted_encodings) - 1; /* discard NONE */
   if (level == GRPC_COMPRESS_LEVEL_NONE || num_supported == 0) {
@@ -217,9 +302,11 @@ grpc_message_compression_algorithm grpc_message_compression_algorithm_for_level(
   /* Establish a "ranking" or compression algorithms in increasing order of
    * compression.
    * This is simplistic and we will probably want to introduce other dimensions
-   * in the future (cpu/memory cost, etc). */
+   * in the future (cpu/memory cost, etc). lz4 trades ratio for speed, so it
+   * ranks lowest; zstd at its default level compresses better than zlib. */
   const grpc_message_compression_algorithm algos_ranking[] = {
-      GRPC_MESSAGE_COMPRESS_GZIP, GRPC_MESSAGE_COMPRESS_DEFLATE};
+      GRPC_MESSAGE_COMPRESS_LZ4, GRPC_MESSAGE_COMPRESS_GZIP,
+      GRPC_MESSAGE_COMPRESS_DEFLATE, GRPC_MESSAGE_COMPRESS_ZSTD};
 
   /* intersect algos_ranking with the supported ones keeping the ranked order */
   grpc_message_compression_algorithm
@@ -262,6 +349,12 @@ int grpc_message_compression_algorithm_parse(
   } else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_GZIP)) {
     *algorithm = GRPC_MESSAGE_COMPRESS_GZIP;
     return 1;
+  } else if (grpc_slice_str_cmp(value, "zstd") == 0) {
+    *algorithm = GRPC_MESSAGE_COMPRESS_ZSTD;
+    return 1;
+  } else if (grpc_slice_str_cmp(value, "lz4") == 0) {
+    *algorithm = GRPC_MESSAGE_COMPRESS_LZ4;
+    return 1;
   } else {
     return 0;
   }
@@ -34,6 +34,8 @@ typedef enum {
   GRPC_MESSAGE_COMPRESS_NONE = 0,
   GRPC_MESSAGE_COMPRESS_DEFLATE,
   GRPC_MESSAGE_COMPRESS_GZIP,
+  GRPC_MESSAGE_COMPRESS_ZSTD,
+  GRPC_MESSAGE_COMPRESS_LZ4,
   /* TODO(ctiller): snappy */
   GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT
 } grpc_message_compression_algorithm;
@@ -58,6 +60,12 @@ grpc_compression_algorithm_to_stream_compression_algorithm(
 
 uint32_t grpc_compression_bitset_to_message_bitset(uint32_t bitset);
 
+/* Returns the bitset of the algorithms in \a grpc_compression_algorithm that
+ * this build is able to compress and decompress. zstd and lz4 are optional
+ * dependencies: they are only included when GRPC_HAVE_ZSTD and GRPC_HAVE_LZ4
+ * are respectively defined. */
+uint32_t grpc_compression_algorithms_available_bitset(void);
+
 uint32_t grpc_compression_bitset_to_stream_bitset(uint32_t bitset);
 
 uint32_t grpc_compression_bitset_from_message_stream_compression_bitset(
@@ -26,6 +26,12 @@
 #include <grpc/support/log.h>
 
 #include <zlib.h>
+#ifdef GRPC_HAVE_ZSTD
+#include <zstd.h>
+#endif
+#ifdef GRPC_HAVE_LZ4
+#include <lz4frame.h>
+#endif
 
 #include "src/core/lib/slice/slice_internal.h"
 
@@ -33,7 +39,8 @@
 
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush),
+                     const grpc_slice& dictionary) {
   int r = Z_STREAM_END; /* Do not fail on an empty input. */
   int flush;
   size_t i;
@@ -58,6 +65,18 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
         zs->next_out = GRPC_SLICE_START_PTR(outbuf);
       }
       r = flate(zs, flush);
+      if (r == Z_NEED_DICT) {
+        /* the stream was compressed against a preset dictionary: zlib checks
+           that it is the same one */
+        if (GRPC_SLICE_LENGTH(dictionary) == 0 ||
+            inflateSetDictionary(
+                zs, GRPC_SLICE_START_PTR(dictionary),
+                static_cast<uInt>(GRPC_SLICE_LENGTH(dictionary))) != Z_OK) {
+          gpr_log(GPR_INFO, "zlib: missing or mismatched preset dictionary");
+          goto error;
+        }
+        r = flate(zs, flush);
+      }
       if (r < 0 && r != Z_BUF_ERROR /* not fatal */) {
         gpr_log(GPR_INFO, "zlib error (%d)", r);
         goto error;
@@ -92,7 +111,7 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                         int gzip) {
+                         int gzip, const grpc_slice& dictionary) {
   z_stream zs;
   int r;
   size_t i;
@@ -104,7 +123,14 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
                    8, Z_DEFAULT_STRATEGY);
   GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
+  /* the gzip format has no room for a dictionary id */
+  if (!gzip && GRPC_SLICE_LENGTH(dictionary) > 0) {
+    r = deflateSetDictionary(&zs, GRPC_SLICE_START_PTR(dictionary),
+                             static_cast<uInt>(GRPC_SLICE_LENGTH(dictionary)));
+    GPR_ASSERT(r == Z_OK);
+  }
+  r = zlib_body(&zs, input, output, deflate, dictionary) &&
+      output->length < input->length;
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_slice_unref_internal(output->slices[i]);
@@ -117,7 +143,7 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
 }
 
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                           int gzip) {
+                           int gzip, const grpc_slice& dictionary) {
   z_stream zs;
   int r;
   size_t i;
@@ -128,7 +154,7 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   zs.zfree = zfree_gpr;
   r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
   GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
+  r = zlib_body(&zs, input, output, inflate, dictionary);
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_slice_unref_internal(output->slices[i]);
@@ -140,6 +166,225 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   return r;
 }
 
+static void reset_output(grpc_slice_buffer* output, size_t count_before,
+                         size_t length_before) {
+  for (size_t i = count_before; i < output->count; i++) {
+    grpc_slice_unref_internal(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+}
+
+#ifdef GRPC_HAVE_ZSTD
+static int zstd_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                         const grpc_slice& dictionary) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  ZSTD_CCtx* cctx = ZSTD_createCCtx();
+  GPR_ASSERT(cctx != nullptr);
+  /* lets zstd size its window to the message and record the content size in
+     the frame header */
+  ZSTD_CCtx_setPledgedSrcSize(cctx, input->length);
+  if (GRPC_SLICE_LENGTH(dictionary) > 0) {
+    /* raw content dictionaries carry no id: the checksum catches a receiver
+       holding a different one */
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_checksumFlag, 1);
+    ZSTD_CCtx_refPrefix(cctx, GRPC_SLICE_START_PTR(dictionary),
+                        GRPC_SLICE_LENGTH(dictionary));
+  }
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf),
+                        GRPC_SLICE_LENGTH(outbuf), 0};
+  int r = 1;
+  size_t i = 0;
+  do {
+    const bool last = i + 1 >= input->count;
+    ZSTD_inBuffer in = {nullptr, 0, 0};
+    if (i < input->count) {
+      in.src = GRPC_SLICE_START_PTR(input->slices[i]);
+      in.size = GRPC_SLICE_LENGTH(input->slices[i]);
+    }
+    const ZSTD_EndDirective mode = last ? ZSTD_e_end : ZSTD_e_continue;
+    size_t remaining;
+    do {
+      if (out.pos == out.size) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        out.dst = GRPC_SLICE_START_PTR(outbuf);
+        out.size = GRPC_SLICE_LENGTH(outbuf);
+        out.pos = 0;
+      }
+      remaining = ZSTD_compressStream2(cctx, &out, &in, mode);
+      if (ZSTD_isError(remaining)) {
+        gpr_log(GPR_INFO, "zstd error (%s)", ZSTD_getErrorName(remaining));
+        r = 0;
+        break;
+      }
+    } while (last ? remaining != 0 : in.pos != in.size);
+  } while (r && ++i < input->count);
+  if (r) {
+    GRPC_SLICE_SET_LENGTH(outbuf, out.pos);
+    grpc_slice_buffer_add_indexed(output, outbuf);
+    r = output->length - length_before < input->length;
+  } else {
+    grpc_slice_unref_internal(outbuf);
+  }
+  if (!r) reset_output(output, count_before, length_before);
+  ZSTD_freeCCtx(cctx);
+  return r;
+}
+
+static int zstd_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                           const grpc_slice& dictionary) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  ZSTD_DCtx* dctx = ZSTD_createDCtx();
+  GPR_ASSERT(dctx != nullptr);
+  /* frames that were compressed without the dictionary decode just the same
+     with it */
+  if (GRPC_SLICE_LENGTH(dictionary) > 0) {
+    ZSTD_DCtx_refPrefix(dctx, GRPC_SLICE_START_PTR(dictionary),
+                        GRPC_SLICE_LENGTH(dictionary));
+  }
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf),
+                        GRPC_SLICE_LENGTH(outbuf), 0};
+  size_t hint = 0; /* Do not fail on an empty input. */
+  for (size_t i = 0; i < input->count; i++) {
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    /* a full output buffer may hide pending output, unless the frame is
+       already complete */
+    do {
+      if (out.pos == out.size) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        out.dst = GRPC_SLICE_START_PTR(outbuf);
+        out.size = GRPC_SLICE_LENGTH(outbuf);
+        out.pos = 0;
+      }
+      hint = ZSTD_decompressStream(dctx, &out, &in);
+      if (ZSTD_isError(hint)) {
+        gpr_log(GPR_INFO, "zstd error (%s)", ZSTD_getErrorName(hint));
+        goto error;
+      }
+    } while (in.pos != in.size || (out.pos == out.size && hint != 0));
+  }
+  if (hint != 0) {
+    gpr_log(GPR_INFO, "zstd: Data error");
+    goto error;
+  }
+  GRPC_SLICE_SET_LENGTH(outbuf, out.pos);
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  ZSTD_freeDCtx(dctx);
+  return 1;
+
+error:
+  grpc_slice_unref_internal(outbuf);
+  reset_output(output, count_before, length_before);
+  ZSTD_freeDCtx(dctx);
+  return 0;
+}
+#endif /* GRPC_HAVE_ZSTD */
+
+#ifdef GRPC_HAVE_LZ4
+static int lz4_compress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  LZ4F_preferences_t prefs;
+  memset(&prefs, 0, sizeof(prefs));
+  prefs.frameInfo.contentSize = input->length;
+  prefs.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+  LZ4F_cctx* cctx;
+  GPR_ASSERT(!LZ4F_isError(
+      LZ4F_createCompressionContext(&cctx, LZ4F_VERSION)));
+  /* lz4 frames are bounded tightly enough that the whole message goes into a
+     single slice */
+  grpc_slice outbuf =
+      GRPC_SLICE_MALLOC(LZ4F_compressFrameBound(input->length, &prefs));
+  uint8_t* start = GRPC_SLICE_START_PTR(outbuf);
+  uint8_t* end = GRPC_SLICE_END_PTR(outbuf);
+  uint8_t* out = start;
+  int r = 0;
+  size_t n = LZ4F_compressBegin(cctx, out, end - out, &prefs);
+  if (LZ4F_isError(n)) goto done;
+  out += n;
+  for (size_t i = 0; i < input->count; i++) {
+    n = LZ4F_compressUpdate(cctx, out, end - out,
+                            GRPC_SLICE_START_PTR(input->slices[i]),
+                            GRPC_SLICE_LENGTH(input->slices[i]), nullptr);
+    if (LZ4F_isError(n)) goto done;
+    out += n;
+  }
+  n = LZ4F_compressEnd(cctx, out, end - out, nullptr);
+  if (LZ4F_isError(n)) goto done;
+  out += n;
+  r = static_cast<size_t>(out - start) < input->length;
+
+done:
+  if (LZ4F_isError(n)) {
+    gpr_log(GPR_INFO, "lz4 error (%s)", LZ4F_getErrorName(n));
+  }
+  if (r) {
+    GRPC_SLICE_SET_LENGTH(outbuf, out - start);
+    grpc_slice_buffer_add_indexed(output, outbuf);
+  } else {
+    grpc_slice_unref_internal(outbuf);
+  }
+  LZ4F_freeCompressionContext(cctx);
+  return r;
+}
+
+static int lz4_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  LZ4F_dctx* dctx;
+  GPR_ASSERT(!LZ4F_isError(
+      LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION)));
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  size_t out_pos = 0;
+  size_t hint = 0; /* Do not fail on an empty input. */
+  for (size_t i = 0; i < input->count; i++) {
+    const uint8_t* in = GRPC_SLICE_START_PTR(input->slices[i]);
+    const uint8_t* in_end = GRPC_SLICE_END_PTR(input->slices[i]);
+    size_t out_avail;
+    /* a full output buffer may hide pending output, unless the frame is
+       already complete */
+    do {
+      if (out_pos == GRPC_SLICE_LENGTH(outbuf)) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        out_pos = 0;
+      }
+      out_avail = GRPC_SLICE_LENGTH(outbuf) - out_pos;
+      size_t in_avail = in_end - in;
+      size_t out_size = out_avail;
+      hint = LZ4F_decompress(dctx, GRPC_SLICE_START_PTR(outbuf) + out_pos,
+                             &out_size, in, &in_avail, nullptr);
+      if (LZ4F_isError(hint)) {
+        gpr_log(GPR_INFO, "lz4 error (%s)", LZ4F_getErrorName(hint));
+        goto error;
+      }
+      in += in_avail;
+      out_pos += out_size;
+      out_avail -= out_size;
+    } while (in != in_end || (out_avail == 0 && hint != 0));
+  }
+  if (hint != 0) {
+    gpr_log(GPR_INFO, "lz4: Data error");
+    goto error;
+  }
+  GRPC_SLICE_SET_LENGTH(outbuf, out_pos);
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  LZ4F_freeDecompressionContext(dctx);
+  return 1;
+
+error:
+  grpc_slice_unref_internal(outbuf);
+  reset_output(output, count_before, length_before);
+  LZ4F_freeDecompressionContext(dctx);
+  return 0;
+}
+#endif /* GRPC_HAVE_LZ4 */
+
 static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   size_t i;
   for (i = 0; i < input->count; i++) {
@@ -149,6 +394,7 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
 }
 
 static int compress_inner(grpc_message_compression_algorithm algorithm,
+                          const grpc_slice& dictionary,
                           grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_MESSAGE_COMPRESS_NONE:
@@ -156,9 +402,21 @@ static int compress_inner(grpc_message_compression_algorithm algorithm,
          rely on that here */
       return 0;
     case GRPC_MESSAGE_COMPRESS_DEFLATE:
-      return zlib_compress(input, output, 0);
+      return zlib_compress(input, output, 0, dictionary);
     case GRPC_MESSAGE_COMPRESS_GZIP:
-      return zlib_compress(input, output, 1);
+      return zlib_compress(input, output, 1, dictionary);
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_compress(input, output, dictionary);
+#else
+      break;
+#endif
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+#ifdef GRPC_HAVE_LZ4
+      return lz4_compress(input, output);
+#else
+      break;
+#endif
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -168,22 +426,60 @@ static int compress_inner(grpc_message_compression_algorithm algorithm,
 
 int grpc_msg_compress(grpc_message_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+  return grpc_msg_compress_with_dictionary(algorithm, grpc_empty_slice(),
+                                           input, output);
+}
+
+int grpc_msg_decompress(grpc_message_compression_algorithm algorithm,
+                        grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  return grpc_msg_decompress_with_dictionary(algorithm, grpc_empty_slice(),
+                                             input, output);
+}
+
+int grpc_msg_compression_algorithm_supports_dictionary(
+    grpc_message_compression_algorithm algorithm) {
+  return algorithm == GRPC_MESSAGE_COMPRESS_DEFLATE ||
+         algorithm == GRPC_MESSAGE_COMPRESS_ZSTD;
+}
+
+uint32_t grpc_msg_compression_dictionary_id(const grpc_slice& dictionary) {
+  return static_cast<uint32_t>(
+      adler32(adler32(0, Z_NULL, 0), GRPC_SLICE_START_PTR(dictionary),
+              static_cast<uInt>(GRPC_SLICE_LENGTH(dictionary))));
+}
+
+int grpc_msg_compress_with_dictionary(
+    grpc_message_compression_algorithm algorithm, const grpc_slice& dictionary,
+    grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  if (!compress_inner(algorithm, dictionary, input, output)) {
     copy(input, output);
     return 0;
   }
   return 1;
 }
 
-int grpc_msg_decompress(grpc_message_compression_algorithm algorithm,
-                        grpc_slice_buffer* input, grpc_slice_buffer* output) {
+int grpc_msg_decompress_with_dictionary(
+    grpc_message_compression_algorithm algorithm, const grpc_slice& dictionary,
+    grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_MESSAGE_COMPRESS_NONE:
       return copy(input, output);
     case GRPC_MESSAGE_COMPRESS_DEFLATE:
-      return zlib_decompress(input, output, 0);
+      return zlib_decompress(input, output, 0, dictionary);
     case GRPC_MESSAGE_COMPRESS_GZIP:
-      return zlib_decompress(input, output, 1);
+      return zlib_decompress(input, output, 1, dictionary);
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_decompress(input, output, dictionary);
+#else
+      break;
+#endif
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+#ifdef GRPC_HAVE_LZ4
+      return lz4_decompress(input, output);
+#else
+      break;
+#endif
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -37,4 +37,27 @@ int grpc_msg_compress(grpc_message_compression_algorithm algorithm,
 int grpc_msg_decompress(grpc_message_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+/* Like grpc_msg_compress, but compresses against the preset 'dictionary' when
+   it is non-empty and 'algorithm' supports one. The receiver needs the same
+   dictionary to decompress the result. */
+int grpc_msg_compress_with_dictionary(
+    grpc_message_compression_algorithm algorithm, const grpc_slice& dictionary,
+    grpc_slice_buffer* input, grpc_slice_buffer* output);
+
+/* Like grpc_msg_decompress, but makes 'dictionary' available to messages that
+   were compressed against it. Messages compressed without a dictionary
+   decompress as usual. */
+int grpc_msg_decompress_with_dictionary(
+    grpc_message_compression_algorithm algorithm, const grpc_slice& dictionary,
+    grpc_slice_buffer* input, grpc_slice_buffer* output);
+
+/* Returns 1 if 'algorithm' can compress against a preset dictionary: deflate
+   and zstd can, gzip and lz4 cannot. */
+int grpc_msg_compression_algorithm_supports_dictionary(
+    grpc_message_compression_algorithm algorithm);
+
+/* Returns the id peers compare to check they hold the same 'dictionary': its
+   Adler-32 checksum, which is also what zlib records in deflate streams. */
+uint32_t grpc_msg_compression_dictionary_id(const grpc_slice& dictionary);
+
 #endif /* GRPC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H */
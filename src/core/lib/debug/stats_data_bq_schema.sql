@@ -12,6 +12,9 @@ pollset_kicked_again_per_iteration:FLOAT,
 pollset_kick_wakeup_fd_per_iteration:FLOAT,
 pollset_kick_wakeup_cv_per_iteration:FLOAT,
 pollset_kick_own_thread_per_iteration:FLOAT,
+busy_poll_spins_per_iteration:FLOAT,
+busy_poll_hits_per_iteration:FLOAT,
+busy_poll_sleeps_per_iteration:FLOAT,
 syscall_epoll_ctl_per_iteration:FLOAT,
 pollset_fd_cache_hits_per_iteration:FLOAT,
 histogram_slow_lookups_per_iteration:FLOAT,
@@ -33,6 +36,8 @@ http2_writes_begun_per_iteration:FLOAT,
 http2_writes_offloaded_per_iteration:FLOAT,
 http2_writes_continued_per_iteration:FLOAT,
 http2_partial_writes_per_iteration:FLOAT,
+http2_writes_coalesced_per_iteration:FLOAT,
+http2_coalesced_writes_cut_short_per_iteration:FLOAT,
 http2_initiate_write_due_to_initial_write_per_iteration:FLOAT,
 http2_initiate_write_due_to_start_new_stream_per_iteration:FLOAT,
 http2_initiate_write_due_to_send_message_per_iteration:FLOAT,
@@ -33,11 +33,14 @@
 
 namespace {
 
-void* ArenaStorage(size_t initial_size) {
+size_t ArenaStorageSize(size_t initial_size) {
   static constexpr size_t base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_core::Arena));
-  initial_size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
-  size_t alloc_size = base_size + initial_size;
+  return base_size + GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
+}
+
+void* ArenaStorage(size_t initial_size) {
+  size_t alloc_size = ArenaStorageSize(initial_size);
   static constexpr size_t alignment =
       (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
        GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
@@ -100,4 +103,80 @@ void* Arena::AllocZone(size_t size) {
   return reinterpret_cast<char*>(z) + zone_base_size;
 }
 
+std::pair<Arena*, void*> ArenaPool::CreateWithAlloc(size_t initial_size,
+                                                    size_t alloc_size) {
+  static constexpr size_t base_size =
+      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
+  FreeArena* reused = nullptr;
+  FreeArena* stale = nullptr;
+  {
+    MutexLock lock(&mu_);
+    // Arenas sized for a different call size estimate than the current one
+    // would either overflow or waste memory: drop them on the way.
+    while (free_list_ != nullptr) {
+      FreeArena* f = free_list_;
+      free_list_ = f->next;
+      cached_bytes_ -= ArenaStorageSize(f->initial_zone_size);
+      if (f->initial_zone_size >= initial_size &&
+          f->initial_zone_size <= 2 * initial_size) {
+        reused = f;
+        break;
+      }
+      f->next = stale;
+      stale = f;
+    }
+  }
+  FreeList(stale);
+  if (reused == nullptr) {
+    return Arena::CreateWithAlloc(initial_size, alloc_size);
+  }
+  const size_t initial_zone_size = reused->initial_zone_size;
+  reused->~FreeArena();
+  Arena* arena = new (reused) Arena(initial_zone_size, alloc_size);
+  return std::make_pair(arena, reinterpret_cast<char*>(arena) + base_size);
+}
+
+size_t ArenaPool::Release(Arena* arena) {
+  static_assert(sizeof(FreeArena) <= sizeof(Arena),
+                "a cached arena must fit in the storage of an arena");
+  const size_t initial_zone_size = arena->initial_zone_size_;
+  const size_t storage_size = ArenaStorageSize(initial_zone_size);
+  const size_t size = arena->total_used_.Load(MemoryOrder::RELAXED);
+  // Frees any additional zones, leaving only the storage of the initial zone.
+  arena->~Arena();
+  {
+    MutexLock lock(&mu_);
+    if (cached_bytes_ + storage_size <= max_cached_bytes_) {
+      free_list_ = new (arena) FreeArena{free_list_, initial_zone_size};
+      cached_bytes_ += storage_size;
+      return size;
+    }
+  }
+  gpr_free_aligned(arena);
+  return size;
+}
+
+size_t ArenaPool::Clear() {
+  FreeArena* list;
+  size_t freed;
+  {
+    MutexLock lock(&mu_);
+    list = free_list_;
+    freed = cached_bytes_;
+    free_list_ = nullptr;
+    cached_bytes_ = 0;
+  }
+  FreeList(list);
+  return freed;
+}
+
+void ArenaPool::FreeList(FreeArena* list) {
+  while (list != nullptr) {
+    FreeArena* next = list->next;
+    list->~FreeArena();
+    gpr_free_aligned(list);
+    list = next;
+  }
+}
+
 }  // namespace grpc_core
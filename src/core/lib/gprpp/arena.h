@@ -36,6 +36,7 @@
 #include "src/core/lib/gpr/alloc.h"
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/gprpp/atomic.h"
+#include "src/core/lib/gprpp/sync.h"
 
 #include <stddef.h>
 
@@ -79,6 +80,8 @@ class Arena {
   }
 
  private:
+  friend class ArenaPool;
+
   struct Zone {
     Zone* prev;
   };
@@ -116,6 +119,47 @@ class Arena {
   Zone* last_zone_ = nullptr;
 };
 
+// A bounded cache of released arenas, so that arenas of about the same size
+// can be handed out again without going back to the allocator. Only the
+// initial zone of an arena is kept: zones allocated on demand are freed when
+// the arena is released.
+class ArenaPool {
+ public:
+  // Cache at most \a max_cached_bytes of arena storage.
+  explicit ArenaPool(size_t max_cached_bytes)
+      : max_cached_bytes_(max_cached_bytes) {}
+  ~ArenaPool() { Clear(); }
+
+  ArenaPool(const ArenaPool&) = delete;
+  ArenaPool& operator=(const ArenaPool&) = delete;
+
+  // Like Arena::CreateWithAlloc(), but reuses a cached arena if one with an
+  // initial zone of at least \a initial_size (and not much more) is available.
+  std::pair<Arena*, void*> CreateWithAlloc(size_t initial_size,
+                                           size_t alloc_size);
+
+  // Like Arena::Destroy(), but keeps the arena for reuse if the cache has room
+  // for it.
+  size_t Release(Arena* arena);
+
+  // Free all cached arenas, returning the number of bytes freed.
+  size_t Clear();
+
+ private:
+  // A cached arena: overlays the storage of the destroyed Arena object.
+  struct FreeArena {
+    FreeArena* next;
+    size_t initial_zone_size;
+  };
+
+  static void FreeList(FreeArena* list);
+
+  const size_t max_cached_bytes_;
+  Mutex mu_;
+  FreeArena* free_list_ ABSL_GUARDED_BY(mu_) = nullptr;
+  size_t cached_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
 }  // namespace grpc_core
 
 #endif /* GRPC_CORE_LIB_GPRPP_ARENA_H */
@@ -36,6 +36,7 @@
 #include "src/core/lib/iomgr/error_internal.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/transport/http2_errors.h"
 
 grpc_core::DebugOnlyTraceFlag grpc_trace_error_refcount(false,
                                                         "error_refcount");
@@ -390,6 +391,48 @@ static void ref_errs(grpc_error* err) {
   }
 }
 
+// Marks an int that a special error does not carry.
+static constexpr intptr_t kSpecialErrorNoInt = -1;
+
+struct special_error_status_map {
+  intptr_t code;
+  intptr_t http2_error;
+  const char* msg;
+  size_t len;
+  // description used when the error is materialized
+  const char* desc;
+  // what grpc_error_string() returns
+  const char* json;
+};
+const special_error_status_map error_status_map[] = {
+    // GRPC_ERROR_NONE
+    {GRPC_STATUS_OK, kSpecialErrorNoInt, "", 0, "no error", "\"No Error\""},
+    // GRPC_ERROR_RESERVED_1
+    {GRPC_STATUS_INVALID_ARGUMENT, kSpecialErrorNoInt, "", 0, "", ""},
+    // GRPC_ERROR_OOM
+    {GRPC_STATUS_RESOURCE_EXHAUSTED, kSpecialErrorNoInt, "Out of memory",
+     strlen("Out of memory"), "oom", "\"Out of memory\""},
+    // GRPC_ERROR_RESERVED_2
+    {GRPC_STATUS_INVALID_ARGUMENT, kSpecialErrorNoInt, "", 0, "", ""},
+    // GRPC_ERROR_CANCELLED
+    {GRPC_STATUS_CANCELLED, kSpecialErrorNoInt, "Cancelled",
+     strlen("Cancelled"), "cancelled", "\"Cancelled\""},
+    // GRPC_ERROR_RESERVED_3
+    {GRPC_STATUS_INVALID_ARGUMENT, kSpecialErrorNoInt, "", 0, "", ""},
+    // GRPC_ERROR_DEADLINE_EXCEEDED
+    {GRPC_STATUS_DEADLINE_EXCEEDED, kSpecialErrorNoInt, "Deadline Exceeded",
+     strlen("Deadline Exceeded"), "Deadline Exceeded",
+     "{\"description\":\"Deadline Exceeded\",\"grpc_status\":4}"},
+    // GRPC_ERROR_RESERVED_4
+    {GRPC_STATUS_INVALID_ARGUMENT, kSpecialErrorNoInt, "", 0, "", ""},
+    // GRPC_ERROR_RST_STREAM_CANCEL
+    {kSpecialErrorNoInt, GRPC_HTTP2_CANCEL,
+     "Received RST_STREAM with error code 8",
+     strlen("Received RST_STREAM with error code 8"), "RST_STREAM",
+     "{\"description\":\"RST_STREAM\",\"grpc_message\":\"Received "
+     "RST_STREAM with error code 8\",\"http2_error\":8}"},
+};
+
 static grpc_error* copy_error_and_unref(grpc_error* in) {
   GPR_TIMER_SCOPE("copy_error_and_unref", 0);
   grpc_error* out;
@@ -406,6 +449,21 @@ static grpc_error* copy_error_and_unref(grpc_error* in) {
       internal_set_str(&out, GRPC_ERROR_STR_DESCRIPTION,
                        grpc_slice_from_static_string("cancelled"));
       internal_set_int(&out, GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED);
+    } else {
+      const special_error_status_map& special =
+          error_status_map[reinterpret_cast<size_t>(in)];
+      internal_set_str(&out, GRPC_ERROR_STR_DESCRIPTION,
+                       grpc_slice_from_static_string(special.desc));
+      if (strcmp(special.msg, special.desc) != 0) {
+        internal_set_str(&out, GRPC_ERROR_STR_GRPC_MESSAGE,
+                         grpc_slice_from_static_string(special.msg));
+      }
+      if (special.code != kSpecialErrorNoInt) {
+        internal_set_int(&out, GRPC_ERROR_INT_GRPC_STATUS, special.code);
+      }
+      if (special.http2_error != kSpecialErrorNoInt) {
+        internal_set_int(&out, GRPC_ERROR_INT_HTTP2_ERROR, special.http2_error);
+      }
     }
   } else if (gpr_ref_is_unique(&in->atomics.refs)) {
     out = in;
@@ -449,26 +507,24 @@ grpc_error* grpc_error_set_int(grpc_error* src, grpc_error_ints which,
   return new_err;
 }
 
-struct special_error_status_map {
-  grpc_status_code code;
-  const char* msg;
-  size_t len;
-};
-const special_error_status_map error_status_map[] = {
-    {GRPC_STATUS_OK, "", 0},                // GRPC_ERROR_NONE
-    {GRPC_STATUS_INVALID_ARGUMENT, "", 0},  // GRPC_ERROR_RESERVED_1
-    {GRPC_STATUS_RESOURCE_EXHAUSTED, "Out of memory",
-     strlen("Out of memory")},              // GRPC_ERROR_OOM
-    {GRPC_STATUS_INVALID_ARGUMENT, "", 0},  // GRPC_ERROR_RESERVED_2
-    {GRPC_STATUS_CANCELLED, "Cancelled",
-     strlen("Cancelled")},  // GRPC_ERROR_CANCELLED
-};
-
 bool grpc_error_get_int(grpc_error* err, grpc_error_ints which, intptr_t* p) {
   GPR_TIMER_SCOPE("grpc_error_get_int", 0);
   if (grpc_error_is_special(err)) {
-    if (which != GRPC_ERROR_INT_GRPC_STATUS) return false;
-    *p = error_status_map[reinterpret_cast<size_t>(err)].code;
+    const special_error_status_map& special =
+        error_status_map[reinterpret_cast<size_t>(err)];
+    intptr_t value;
+    switch (which) {
+      case GRPC_ERROR_INT_GRPC_STATUS:
+        value = special.code;
+        break;
+      case GRPC_ERROR_INT_HTTP2_ERROR:
+        value = special.http2_error;
+        break;
+      default:
+        return false;
+    }
+    if (value == kSpecialErrorNoInt) return false;
+    if (p != nullptr) *p = value;
     return true;
   }
   uint8_t slot = err->ints[which];
@@ -530,10 +586,6 @@ grpc_error* grpc_error_add_child(grpc_error* src, grpc_error* child) {
   }
 }
 
-static const char* no_error_string = "\"No Error\"";
-static const char* oom_error_string = "\"Out of memory\"";
-static const char* cancelled_error_string = "\"Cancelled\"";
-
 struct kv_pair {
   char* key;
   char* value;
@@ -742,9 +794,9 @@ static char* finish_kvs(kv_pairs* kvs) {
 
 const char* grpc_error_string(grpc_error* err) {
   GPR_TIMER_SCOPE("grpc_error_string", 0);
-  if (err == GRPC_ERROR_NONE) return no_error_string;
-  if (err == GRPC_ERROR_OOM) return oom_error_string;
-  if (err == GRPC_ERROR_CANCELLED) return cancelled_error_string;
+  if (grpc_error_is_special(err)) {
+    return error_status_map[reinterpret_cast<size_t>(err)].json;
+  }
 
   void* p =
       reinterpret_cast<void*>(gpr_atm_acq_load(&err->atomics.error_string));
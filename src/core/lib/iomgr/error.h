@@ -120,13 +120,28 @@ typedef enum {
 /// The following "special" errors can be propagated without allocating memory.
 /// They are always even so that other code (particularly combiner locks,
 /// polling engines) can safely use the lower bit for themselves.
+/// Besides the generic ones, a few well-known per-RPC failures are encoded
+/// here so that the common deadline and cancellation paths never touch the
+/// heap. Each carries a fixed message and a fixed status and/or http2 error
+/// (RST_STREAM_CANCEL has no status, see below), and is only materialized
+/// into a real error if something is added to it.
+/// Endpoint read errors and transport close still allocate: they carry the
+/// OS error and peer address that make them useful, so they are not
+/// encoded here.
 
 #define GRPC_ERROR_NONE ((grpc_error*)NULL)
 #define GRPC_ERROR_RESERVED_1 ((grpc_error*)1)
 #define GRPC_ERROR_OOM ((grpc_error*)2)
 #define GRPC_ERROR_RESERVED_2 ((grpc_error*)3)
 #define GRPC_ERROR_CANCELLED ((grpc_error*)4)
-#define GRPC_ERROR_SPECIAL_MAX GRPC_ERROR_CANCELLED
+#define GRPC_ERROR_RESERVED_3 ((grpc_error*)5)
+/// Deadline expiry: status DEADLINE_EXCEEDED, message "Deadline Exceeded".
+#define GRPC_ERROR_DEADLINE_EXCEEDED ((grpc_error*)6)
+#define GRPC_ERROR_RESERVED_4 ((grpc_error*)7)
+/// Peer reset the stream with CANCEL: http2 error CANCEL and no explicit
+/// status, so that the status is still derived from the call deadline.
+#define GRPC_ERROR_RST_STREAM_CANCEL ((grpc_error*)8)
+#define GRPC_ERROR_SPECIAL_MAX GRPC_ERROR_RST_STREAM_CANCEL
 
 inline bool grpc_error_is_special(struct grpc_error* err) {
   return err <= GRPC_ERROR_SPECIAL_MAX;
@@ -38,6 +38,18 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+/* Multishot poll (5.13), timed waits (5.11) and unprivileged SQPOLL on
+   non-registered files (5.11) are all required by the io_uring event source */
+#if defined(IORING_POLL_ADD_MULTI) && defined(IORING_ENTER_EXT_ARG) && \
+    defined(IORING_FEAT_SQPOLL_NONFIXED) && defined(__NR_io_uring_setup)
+#define GRPC_IO_URING_EV 1
+#endif
+#endif
+
 #include <string>
 #include <vector>
 
@@ -133,6 +145,279 @@ static void epoll_set_shutdown() {
   }
 }
 
+/*******************************************************************************
+ * io_uring event source
+ *
+ * When the engine is started as "io_uring", fds are not added to the epoll set.
+ * Instead each fd gets a multishot IORING_OP_POLL_ADD request whose readiness
+ * completions are reaped straight out of the shared completion ring, and
+ * io_uring_enter() is only called once the ring is empty and the designated
+ * poller has to block. Requests are issued by a kernel SQPOLL thread, so
+ * arming and removing polls does not need a syscall either, and completion
+ * task work never interrupts application threads. Everything above the event
+ * source (fds, pollsets, neighborhoods, kicks) is shared with epoll1.
+ */
+
+/* Set once at engine init: true if the io_uring event source is in use */
+static bool g_use_io_uring = false;
+
+/* Set once at engine init from GRPC_POLL_BUSY_POLL_US: if positive, how long
+   (in microseconds) a poller spins on non-blocking epoll_wait() calls before
+   blocking, which is also applied to every polled socket as SO_BUSY_POLL */
+static int g_busy_poll_us = 0;
+
+#ifdef GRPC_IO_URING_EV
+
+#define IO_URING_SQ_ENTRIES 256
+#define IO_URING_CQ_ENTRIES 16384
+/* How long the SQPOLL thread keeps spinning after its last piece of work */
+#define IO_URING_SQ_THREAD_IDLE_MS 2
+
+/* A completion copied out of the completion ring by the designated poller */
+typedef struct io_uring_event {
+  uint64_t user_data;
+  int32_t res;
+  uint32_t flags;
+} io_uring_event;
+
+/* NOTE ON SYNCHRONIZATION:
+ * - The submission side is shared by every thread creating or orphaning fds
+ *   and is serialized by sq_mu.
+ * - The completion side (and the events/num_events/cursor fields) is only
+ *   touched by the designated poller, exactly like g_epoll_set. */
+typedef struct io_uring_ring {
+  int ring_fd;
+
+  gpr_mu sq_mu;
+  unsigned* sq_head;
+  unsigned* sq_tail;
+  unsigned* sq_mask;
+  unsigned* sq_entries;
+  unsigned* sq_flags;
+  unsigned* sq_array;
+  struct io_uring_sqe* sqes;
+
+  unsigned* cq_head;
+  unsigned* cq_tail;
+  unsigned* cq_mask;
+  struct io_uring_cqe* cqes;
+
+  void* ring_ptr;
+  size_t ring_size;
+  size_t sqes_size;
+
+  /* The completions after the last reap. Indexed by g_epoll_set.cursor and
+     bounded by g_epoll_set.num_events */
+  io_uring_event events[MAX_EPOLL_EVENTS];
+} io_uring_ring;
+
+static io_uring_ring g_ring;
+
+/* user_data of requests whose completions carry no information: poll
+   removals and the init-time feature probe */
+static char g_io_uring_ignore_tag;
+static char g_io_uring_probe_tag;
+
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params* p) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+}
+
+static int sys_io_uring_enter(int ring_fd, unsigned to_submit,
+                              unsigned min_complete, unsigned flags, void* arg,
+                              size_t argsz) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, arg, argsz));
+}
+
+/* Queue one poll request for the SQPOLL thread. Only enters the kernel if the
+   SQPOLL thread went idle or the submission ring is full. */
+static void io_uring_submit_poll_sqe(uint8_t opcode, int fd, uint64_t addr,
+                                     uint64_t user_data) {
+  gpr_mu_lock(&g_ring.sq_mu);
+  unsigned tail = *g_ring.sq_tail;
+  while (tail - __atomic_load_n(g_ring.sq_head, __ATOMIC_ACQUIRE) ==
+         *g_ring.sq_entries) {
+    if (sys_io_uring_enter(g_ring.ring_fd, 0, 0, IORING_ENTER_SQ_WAIT, nullptr,
+                           0) < 0 &&
+        errno != EINTR) {
+      gpr_log(GPR_ERROR, "io_uring_enter(SQ_WAIT) failed: %s",
+              strerror(errno));
+    }
+  }
+  unsigned index = tail & *g_ring.sq_mask;
+  struct io_uring_sqe* sqe = &g_ring.sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->fd = fd;
+  sqe->addr = addr;
+  sqe->user_data = user_data;
+  if (opcode == IORING_OP_POLL_ADD) {
+    /* The 16 bit field is read correctly by the kernel on either endianness */
+    sqe->poll_events = POLLIN | POLLOUT | POLLPRI;
+    sqe->len = IORING_POLL_ADD_MULTI;
+  }
+  g_ring.sq_array[index] = index;
+  __atomic_store_n(g_ring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  /* Pairs with the SQPOLL thread setting IORING_SQ_NEED_WAKEUP before it
+     re-checks the tail and goes to sleep */
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (__atomic_load_n(g_ring.sq_flags, __ATOMIC_RELAXED) &
+      IORING_SQ_NEED_WAKEUP) {
+    if (sys_io_uring_enter(g_ring.ring_fd, 0, 0, IORING_ENTER_SQ_WAKEUP,
+                           nullptr, 0) < 0) {
+      gpr_log(GPR_ERROR, "io_uring_enter(SQ_WAKEUP) failed: %s",
+              strerror(errno));
+    }
+  }
+  gpr_mu_unlock(&g_ring.sq_mu);
+}
+
+static void io_uring_arm_poll(int fd, void* data_ptr) {
+  io_uring_submit_poll_sqe(IORING_OP_POLL_ADD, fd, 0,
+                           reinterpret_cast<uint64_t>(data_ptr));
+}
+
+static void io_uring_remove_poll(void* data_ptr) {
+  io_uring_submit_poll_sqe(
+      IORING_OP_POLL_REMOVE, -1, reinterpret_cast<uint64_t>(data_ptr),
+      reinterpret_cast<uint64_t>(&g_io_uring_ignore_tag));
+}
+
+/* Copy up to MAX_EPOLL_EVENTS completions out of the completion ring without
+   entering the kernel. Returns the number of completions copied. */
+static int io_uring_reap_events() {
+  unsigned head = *g_ring.cq_head;
+  unsigned tail = __atomic_load_n(g_ring.cq_tail, __ATOMIC_ACQUIRE);
+  int n = 0;
+  while (head != tail && n < MAX_EPOLL_EVENTS) {
+    const struct io_uring_cqe* cqe = &g_ring.cqes[head & *g_ring.cq_mask];
+    g_ring.events[n].user_data = cqe->user_data;
+    g_ring.events[n].res = cqe->res;
+    g_ring.events[n].flags = cqe->flags;
+    head++;
+    n++;
+  }
+  __atomic_store_n(g_ring.cq_head, head, __ATOMIC_RELEASE);
+  return n;
+}
+
+static void io_uring_ring_unmap() {
+  if (g_ring.sqes != nullptr) munmap(g_ring.sqes, g_ring.sqes_size);
+  if (g_ring.ring_ptr != nullptr) munmap(g_ring.ring_ptr, g_ring.ring_size);
+  g_ring.sqes = nullptr;
+  g_ring.ring_ptr = nullptr;
+  close(g_ring.ring_fd);
+  g_ring.ring_fd = -1;
+}
+
+/* The kernel accepts multishot polls only since 5.13, while everything else
+   we check for predates it. Arm (and immediately remove) one on a pipe: old
+   kernels fail the request with -EINVAL instead of cancelling it. */
+static bool io_uring_supports_multishot_poll() {
+  int pipe_fds[2];
+  if (pipe(pipe_fds) != 0) return false;
+  io_uring_arm_poll(pipe_fds[0], &g_io_uring_probe_tag);
+  io_uring_remove_poll(&g_io_uring_probe_tag);
+  bool supported = false;
+  bool done = false;
+  while (!done) {
+    int r = sys_io_uring_enter(g_ring.ring_fd, 0, 1, IORING_ENTER_GETEVENTS,
+                               nullptr, 0);
+    if (r < 0 && errno != EINTR) break;
+    int n = io_uring_reap_events();
+    for (int i = 0; i < n; i++) {
+      const io_uring_event* ev = &g_ring.events[i];
+      if (ev->user_data == reinterpret_cast<uint64_t>(&g_io_uring_probe_tag) &&
+          (ev->flags & IORING_CQE_F_MORE) == 0) {
+        supported = ev->res == -ECANCELED;
+        done = true;
+      }
+    }
+  }
+  close(pipe_fds[0]);
+  close(pipe_fds[1]);
+  return supported;
+}
+
+/* Must be called *only* once */
+static bool io_uring_init() {
+  struct io_uring_params p;
+  memset(&p, 0, sizeof(p));
+  p.flags = IORING_SETUP_SQPOLL | IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+  p.sq_thread_idle = IO_URING_SQ_THREAD_IDLE_MS;
+  p.cq_entries = IO_URING_CQ_ENTRIES;
+  g_ring.ring_fd = sys_io_uring_setup(IO_URING_SQ_ENTRIES, &p);
+  if (g_ring.ring_fd < 0) {
+    gpr_log(GPR_INFO, "io_uring_setup unavailable: %s", strerror(errno));
+    return false;
+  }
+  const uint32_t required_features =
+      IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG |
+      IORING_FEAT_SQPOLL_NONFIXED;
+  if ((p.features & required_features) != required_features) {
+    gpr_log(GPR_INFO, "io_uring lacks required features (have 0x%x)",
+            p.features);
+    close(g_ring.ring_fd);
+    g_ring.ring_fd = -1;
+    return false;
+  }
+  g_ring.ring_size =
+      GPR_MAX(p.sq_off.array + p.sq_entries * sizeof(unsigned),
+              p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe));
+  g_ring.sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+  g_ring.ring_ptr = mmap(nullptr, g_ring.ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, g_ring.ring_fd,
+                         IORING_OFF_SQ_RING);
+  void* sqes_ptr = mmap(nullptr, g_ring.sqes_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, g_ring.ring_fd,
+                        IORING_OFF_SQES);
+  g_ring.sqes = static_cast<struct io_uring_sqe*>(
+      sqes_ptr == MAP_FAILED ? nullptr : sqes_ptr);
+  if (g_ring.ring_ptr == MAP_FAILED) g_ring.ring_ptr = nullptr;
+  if (g_ring.ring_ptr == nullptr || g_ring.sqes == nullptr) {
+    gpr_log(GPR_ERROR, "io_uring mmap failed: %s", strerror(errno));
+    io_uring_ring_unmap();
+    return false;
+  }
+  char* ring = static_cast<char*>(g_ring.ring_ptr);
+  g_ring.sq_head = reinterpret_cast<unsigned*>(ring + p.sq_off.head);
+  g_ring.sq_tail = reinterpret_cast<unsigned*>(ring + p.sq_off.tail);
+  g_ring.sq_mask = reinterpret_cast<unsigned*>(ring + p.sq_off.ring_mask);
+  g_ring.sq_entries =
+      reinterpret_cast<unsigned*>(ring + p.sq_off.ring_entries);
+  g_ring.sq_flags = reinterpret_cast<unsigned*>(ring + p.sq_off.flags);
+  g_ring.sq_array = reinterpret_cast<unsigned*>(ring + p.sq_off.array);
+  g_ring.cq_head = reinterpret_cast<unsigned*>(ring + p.cq_off.head);
+  g_ring.cq_tail = reinterpret_cast<unsigned*>(ring + p.cq_off.tail);
+  g_ring.cq_mask = reinterpret_cast<unsigned*>(ring + p.cq_off.ring_mask);
+  g_ring.cqes = reinterpret_cast<struct io_uring_cqe*>(ring + p.cq_off.cqes);
+  gpr_mu_init(&g_ring.sq_mu);
+  if (!io_uring_supports_multishot_poll()) {
+    gpr_log(GPR_INFO, "io_uring lacks multishot poll support");
+    gpr_mu_destroy(&g_ring.sq_mu);
+    io_uring_ring_unmap();
+    return false;
+  }
+  gpr_log(GPR_INFO, "grpc io_uring fd: %d", g_ring.ring_fd);
+  gpr_atm_no_barrier_store(&g_epoll_set.num_events, 0);
+  gpr_atm_no_barrier_store(&g_epoll_set.cursor, 0);
+  return true;
+}
+
+static void io_uring_shutdown() {
+  gpr_mu_destroy(&g_ring.sq_mu);
+  io_uring_ring_unmap();
+}
+
+#else /* defined(GRPC_IO_URING_EV) */
+
+static bool io_uring_init() { return false; }
+static void io_uring_shutdown() {}
+static void io_uring_arm_poll(int /*fd*/, void* /*data_ptr*/) {}
+static void io_uring_remove_poll(void* /*data_ptr*/) {}
+
+#endif /* defined(GRPC_IO_URING_EV) */
+
 /*******************************************************************************
  * Fd Declarations
  */
@@ -157,10 +442,22 @@ struct grpc_fd {
 
   /* Only used when GRPC_ENABLE_FORK_SUPPORT=1 */
   grpc_fork_fd_list* fork_fd_list;
+
+  /* Only used by the io_uring event source. A multishot poll request keeps
+     referencing this struct until its final completion is reaped, so an
+     orphaned fd only goes back to the freelist after that. uring_mu serializes
+     re-arming a terminated poll against fd_orphan(). */
+  gpr_mu uring_mu;
+  void* uring_data_ptr;
+  bool uring_poll_armed;
+  bool uring_orphaned;
+  bool uring_zombie;
+  grpc_fd* uring_zombie_prev;
 };
 
 static void fd_global_init(void);
 static void fd_global_shutdown(void);
+static void fd_freelist_push(grpc_fd* fd);
 
 /*******************************************************************************
  * Pollset Declarations
@@ -276,6 +573,11 @@ static bool append_error(grpc_error** composite, grpc_error* error,
 static grpc_fd* fd_freelist = nullptr;
 static gpr_mu fd_freelist_mu;
 
+/* Only used by the io_uring event source: orphaned fds waiting for the final
+   completion of their poll request. Guarded by fd_freelist_mu and doubly linked
+   through freelist_next/uring_zombie_prev. */
+static grpc_fd* fd_zombie_list = nullptr;
+
 /* Only used when GRPC_ENABLE_FORK_SUPPORT=1 */
 static grpc_fd* fork_fd_list_head = nullptr;
 static gpr_mu fork_fd_list_mu;
@@ -292,11 +594,53 @@ static void fd_global_shutdown(void) {
   while (fd_freelist != nullptr) {
     grpc_fd* fd = fd_freelist;
     fd_freelist = fd_freelist->freelist_next;
+    gpr_mu_destroy(&fd->uring_mu);
+    gpr_free(fd);
+  }
+  /* Orphaned fds whose poll request never completed are still reachable from
+     the ring, which is closed right after this */
+  while (fd_zombie_list != nullptr) {
+    grpc_fd* fd = fd_zombie_list;
+    fd_zombie_list = fd_zombie_list->freelist_next;
+    gpr_mu_destroy(&fd->uring_mu);
     gpr_free(fd);
   }
   gpr_mu_destroy(&fd_freelist_mu);
 }
 
+static void fd_freelist_push(grpc_fd* fd) {
+  gpr_mu_lock(&fd_freelist_mu);
+  fd->freelist_next = fd_freelist;
+  fd_freelist = fd;
+  gpr_mu_unlock(&fd_freelist_mu);
+}
+
+/* fd->uring_mu must be held by the caller */
+static void fd_zombie_list_add(grpc_fd* fd) {
+  fd->uring_zombie = true;
+  gpr_mu_lock(&fd_freelist_mu);
+  fd->uring_zombie_prev = nullptr;
+  fd->freelist_next = fd_zombie_list;
+  if (fd_zombie_list != nullptr) fd_zombie_list->uring_zombie_prev = fd;
+  fd_zombie_list = fd;
+  gpr_mu_unlock(&fd_freelist_mu);
+}
+
+/* fd->uring_mu must be held by the caller */
+static void fd_zombie_list_remove(grpc_fd* fd) {
+  fd->uring_zombie = false;
+  gpr_mu_lock(&fd_freelist_mu);
+  if (fd->uring_zombie_prev != nullptr) {
+    fd->uring_zombie_prev->freelist_next = fd->freelist_next;
+  } else {
+    fd_zombie_list = fd->freelist_next;
+  }
+  if (fd->freelist_next != nullptr) {
+    fd->freelist_next->uring_zombie_prev = fd->uring_zombie_prev;
+  }
+  gpr_mu_unlock(&fd_freelist_mu);
+}
+
 static void fork_fd_list_add_grpc_fd(grpc_fd* fd) {
   if (grpc_core::Fork::Enabled()) {
     gpr_mu_lock(&fork_fd_list_mu);
@@ -329,6 +673,23 @@ static void fork_fd_list_remove_grpc_fd(grpc_fd* fd) {
   }
 }
 
+/* Ask the kernel to busy poll the device queue when reading from a socket.
+   Raising the value above net.core.busy_read needs CAP_NET_ADMIN, so failures
+   are only logged once. */
+static void fd_set_busy_poll(int fd) {
+#ifdef SO_BUSY_POLL
+  static bool logged_failure = false;
+  if (setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &g_busy_poll_us,
+                 sizeof(g_busy_poll_us)) != 0 &&
+      errno != ENOTSOCK && !logged_failure) {
+    logged_failure = true;
+    gpr_log(GPR_INFO, "setsockopt(SO_BUSY_POLL) failed: %s", strerror(errno));
+  }
+#else
+  (void)fd;
+#endif
+}
+
 static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
   grpc_fd* new_fd = nullptr;
 
@@ -344,6 +705,7 @@ static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
     new_fd->read_closure.Init();
     new_fd->write_closure.Init();
     new_fd->error_closure.Init();
+    gpr_mu_init(&new_fd->uring_mu);
   }
   new_fd->fd = fd;
   new_fd->read_closure->InitEvent();
@@ -361,18 +723,33 @@ static grpc_fd* fd_create(int fd, const char* name, bool track_err) {
   }
 #endif
 
+  /* Use the least significant bit of the event data pointer to store
+   * track_err. We expect the addresses to be word aligned. We need to store
+   * track_err to avoid synchronization issues when accessing it after receiving
+   * an event. Accessing fd would be a data race there because the fd might have
+   * been returned to the free list at that point. */
+  void* data_ptr = reinterpret_cast<void*>(reinterpret_cast<intptr_t>(new_fd) |
+                                           (track_err ? 1 : 0));
+  if (g_use_io_uring) {
+    gpr_mu_lock(&new_fd->uring_mu);
+    new_fd->uring_data_ptr = data_ptr;
+    new_fd->uring_poll_armed = true;
+    new_fd->uring_orphaned = false;
+    new_fd->uring_zombie = false;
+    io_uring_arm_poll(fd, data_ptr);
+    gpr_mu_unlock(&new_fd->uring_mu);
+    return new_fd;
+  }
+
   struct epoll_event ev;
   ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLOUT | EPOLLET);
-  /* Use the least significant bit of ev.data.ptr to store track_err. We expect
-   * the addresses to be word aligned. We need to store track_err to avoid
-   * synchronization issues when accessing it after receiving an event.
-   * Accessing fd would be a data race there because the fd might have been
-   * returned to the free list at that point. */
-  ev.data.ptr = reinterpret_cast<void*>(reinterpret_cast<intptr_t>(new_fd) |
-                                        (track_err ? 1 : 0));
+  ev.data.ptr = data_ptr;
   if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
     gpr_log(GPR_ERROR, "epoll_ctl failed: %s", strerror(errno));
   }
+  if (g_busy_poll_us > 0) {
+    fd_set_busy_poll(fd);
+  }
 
   return new_fd;
 }
@@ -387,7 +764,7 @@ static void fd_shutdown_internal(grpc_fd* fd, grpc_error* why,
   if (fd->read_closure->SetShutdown(GRPC_ERROR_REF(why))) {
     if (!releasing_fd) {
       shutdown(fd->fd, SHUT_RDWR);
-    } else {
+    } else if (!g_use_io_uring) {
       /* we need a phony event for earlier linux versions. */
       epoll_event phony_event;
       if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_DEL, fd->fd, &phony_event) !=
@@ -416,6 +793,17 @@ static void fd_orphan(grpc_fd* fd, grpc_closure* on_done, int* release_fd,
                          is_release_fd);
   }
 
+  /* With io_uring the poll request holds a reference to the file, so it has to
+     be removed for close() to take effect. Mark the fd orphaned first so the
+     poller cannot re-arm it on a descriptor number that is about to be
+     reused. */
+  if (g_use_io_uring) {
+    gpr_mu_lock(&fd->uring_mu);
+    fd->uring_orphaned = true;
+    if (fd->uring_poll_armed) io_uring_remove_poll(fd->uring_data_ptr);
+    gpr_mu_unlock(&fd->uring_mu);
+  }
+
   /* If release_fd is not NULL, we should be relinquishing control of the file
      descriptor fd->fd (but we still own the grpc_fd structure). */
   if (is_release_fd) {
@@ -432,10 +820,19 @@ static void fd_orphan(grpc_fd* fd, grpc_closure* on_done, int* release_fd,
   fd->write_closure->DestroyEvent();
   fd->error_closure->DestroyEvent();
 
-  gpr_mu_lock(&fd_freelist_mu);
-  fd->freelist_next = fd_freelist;
-  fd_freelist = fd;
-  gpr_mu_unlock(&fd_freelist_mu);
+  if (g_use_io_uring) {
+    gpr_mu_lock(&fd->uring_mu);
+    if (fd->uring_poll_armed) {
+      /* The poller returns it to the freelist on the final completion */
+      fd_zombie_list_add(fd);
+    } else {
+      fd_freelist_push(fd);
+    }
+    gpr_mu_unlock(&fd->uring_mu);
+    return;
+  }
+
+  fd_freelist_push(fd);
 }
 
 static bool fd_is_shutdown(grpc_fd* fd) {
@@ -460,6 +857,28 @@ static void fd_become_writable(grpc_fd* fd) { fd->write_closure->SetReady(); }
 
 static void fd_has_errors(grpc_fd* fd) { fd->error_closure->SetReady(); }
 
+/* Called by the designated poller on the final completion of an fd's io_uring
+   poll request, once every earlier completion for it has been processed */
+static void fd_io_uring_poll_terminated(grpc_fd* fd, int32_t res) {
+  gpr_mu_lock(&fd->uring_mu);
+  fd->uring_poll_armed = false;
+  if (fd->uring_orphaned) {
+    if (fd->uring_zombie) {
+      fd_zombie_list_remove(fd);
+      fd_freelist_push(fd);
+    }
+  } else if (res >= 0) {
+    /* The kernel ended the request early (e.g. on completion ring overflow):
+       keep watching the fd */
+    fd->uring_poll_armed = true;
+    io_uring_arm_poll(fd->fd, fd->uring_data_ptr);
+  } else {
+    gpr_log(GPR_ERROR, "io_uring poll on fd %d failed: %s", fd->fd,
+            strerror(-res));
+  }
+  gpr_mu_unlock(&fd->uring_mu);
+}
+
 /*******************************************************************************
  * Pollset Definitions
  */
@@ -521,12 +940,16 @@ static grpc_error* pollset_global_init(void) {
   global_wakeup_fd.read_fd = -1;
   grpc_error* err = grpc_wakeup_fd_init(&global_wakeup_fd);
   if (err != GRPC_ERROR_NONE) return err;
-  struct epoll_event ev;
-  ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLET);
-  ev.data.ptr = &global_wakeup_fd;
-  if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_ADD, global_wakeup_fd.read_fd,
-                &ev) != 0) {
-    return GRPC_OS_ERROR(errno, "epoll_ctl");
+  if (g_use_io_uring) {
+    io_uring_arm_poll(global_wakeup_fd.read_fd, &global_wakeup_fd);
+  } else {
+    struct epoll_event ev;
+    ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLET);
+    ev.data.ptr = &global_wakeup_fd;
+    if (epoll_ctl(g_epoll_set.epfd, EPOLL_CTL_ADD, global_wakeup_fd.read_fd,
+                  &ev) != 0) {
+      return GRPC_OS_ERROR(errno, "epoll_ctl");
+    }
   }
   g_num_neighborhoods = GPR_CLAMP(gpr_cpu_num_cores(), 1, MAX_NEIGHBORHOODS);
   g_neighborhoods = static_cast<pollset_neighborhood*>(
@@ -655,6 +1078,32 @@ static int poll_deadline_to_millis_timeout(grpc_millis millis) {
   }
 }
 
+/* Dispatch the readiness events reported for the fd encoded in data_ptr. The
+   io_uring poll masks use the same bit values as epoll events. */
+static void process_fd_events(void* data_ptr, uint32_t events) {
+  grpc_fd* fd = reinterpret_cast<grpc_fd*>(
+      reinterpret_cast<intptr_t>(data_ptr) & ~static_cast<intptr_t>(1));
+  bool track_err =
+      reinterpret_cast<intptr_t>(data_ptr) & static_cast<intptr_t>(1);
+  bool cancel = (events & EPOLLHUP) != 0;
+  bool error = (events & EPOLLERR) != 0;
+  bool read_ev = (events & (EPOLLIN | EPOLLPRI)) != 0;
+  bool write_ev = (events & EPOLLOUT) != 0;
+  bool err_fallback = error && !track_err;
+
+  if (error && !err_fallback) {
+    fd_has_errors(fd);
+  }
+
+  if (read_ev || cancel || err_fallback) {
+    fd_become_readable(fd);
+  }
+
+  if (write_ev || cancel || err_fallback) {
+    fd_become_writable(fd);
+  }
+}
+
 /* Process the epoll events found by do_epoll_wait() function.
    - g_epoll_set.cursor points to the index of the first event to be processed
    - This function then processes up-to MAX_EPOLL_EVENTS_PER_ITERATION and
@@ -681,33 +1130,37 @@ static grpc_error* process_epoll_events(grpc_pollset* /*pollset*/) {
       append_error(&error, grpc_wakeup_fd_consume_wakeup(&global_wakeup_fd),
                    err_desc);
     } else {
-      grpc_fd* fd = reinterpret_cast<grpc_fd*>(
-          reinterpret_cast<intptr_t>(data_ptr) & ~static_cast<intptr_t>(1));
-      bool track_err =
-          reinterpret_cast<intptr_t>(data_ptr) & static_cast<intptr_t>(1);
-      bool cancel = (ev->events & EPOLLHUP) != 0;
-      bool error = (ev->events & EPOLLERR) != 0;
-      bool read_ev = (ev->events & (EPOLLIN | EPOLLPRI)) != 0;
-      bool write_ev = (ev->events & EPOLLOUT) != 0;
-      bool err_fallback = error && !track_err;
-
-      if (error && !err_fallback) {
-        fd_has_errors(fd);
-      }
-
-      if (read_ev || cancel || err_fallback) {
-        fd_become_readable(fd);
-      }
-
-      if (write_ev || cancel || err_fallback) {
-        fd_become_writable(fd);
-      }
+      process_fd_events(data_ptr, ev->events);
     }
   }
   gpr_atm_rel_store(&g_epoll_set.cursor, cursor);
   return error;
 }
 
+/* Busy-poll mode: spin on non-blocking epoll_wait() calls for up to
+   g_busy_poll_us, but not past the deadline. Kicks are seen too, since the
+   wakeup fd is part of the epoll set. Returns the number of events found, 0 if
+   the budget ran out, or -1 with errno set. Same synchronization rules as
+   do_epoll_wait(). */
+static int do_epoll_busy_poll(grpc_millis deadline) {
+  gpr_timespec spin_end = gpr_time_min(
+      gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                   gpr_time_from_micros(g_busy_poll_us, GPR_TIMESPAN)),
+      grpc_millis_to_timespec(deadline, GPR_CLOCK_MONOTONIC));
+  do {
+    GRPC_STATS_INC_SYSCALL_POLL();
+    GRPC_STATS_INC_BUSY_POLL_SPINS();
+    int r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
+                       0);
+    if (r > 0) {
+      GRPC_STATS_INC_BUSY_POLL_HITS();
+      return r;
+    }
+    if (r < 0 && errno != EINTR) return r;
+  } while (gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), spin_end) < 0);
+  return 0;
+}
+
 /* Do epoll_wait and store the events in g_epoll_set.events field. This does not
    "process" any of the events yet; that is done in process_epoll_events().
    *See process_epoll_events() function for more details.
@@ -718,18 +1171,31 @@ static grpc_error* process_epoll_events(grpc_pollset* /*pollset*/) {
 static grpc_error* do_epoll_wait(grpc_pollset* ps, grpc_millis deadline) {
   GPR_TIMER_SCOPE("do_epoll_wait", 0);
 
-  int r;
+  int r = 0;
   int timeout = poll_deadline_to_millis_timeout(deadline);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_START_BLOCKING_REGION;
+  if (timeout != 0 && g_busy_poll_us > 0) {
+    r = do_epoll_busy_poll(deadline);
+    if (r == 0) {
+      /* Nothing turned up while spinning: block for whatever time is left */
+      grpc_core::ExecCtx::Get()->InvalidateNow();
+      timeout = poll_deadline_to_millis_timeout(deadline);
+      if (timeout != 0) {
+        GRPC_STATS_INC_BUSY_POLL_SLEEPS();
+      }
+    }
   }
-  do {
-    GRPC_STATS_INC_SYSCALL_POLL();
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
-  } while (r < 0 && errno == EINTR);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_END_BLOCKING_REGION;
+  if (r == 0) {
+    if (timeout != 0) {
+      GRPC_SCHEDULING_START_BLOCKING_REGION;
+    }
+    do {
+      GRPC_STATS_INC_SYSCALL_POLL();
+      r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
+                     timeout);
+    } while (r < 0 && errno == EINTR);
+    if (timeout != 0) {
+      GRPC_SCHEDULING_END_BLOCKING_REGION;
+    }
   }
 
   if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
@@ -746,6 +1212,125 @@ static grpc_error* do_epoll_wait(grpc_pollset* ps, grpc_millis deadline) {
   return GRPC_ERROR_NONE;
 }
 
+#ifdef GRPC_IO_URING_EV
+
+/* io_uring counterpart of process_epoll_events(): processes up-to
+   MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION completions from g_ring.events.
+   Same synchronization rules apply. */
+static grpc_error* process_io_uring_events(grpc_pollset* /*pollset*/) {
+  GPR_TIMER_SCOPE("process_io_uring_events", 0);
+
+  static const char* err_desc = "process_events";
+  grpc_error* error = GRPC_ERROR_NONE;
+  long num_events = gpr_atm_acq_load(&g_epoll_set.num_events);
+  long cursor = gpr_atm_acq_load(&g_epoll_set.cursor);
+  for (int idx = 0;
+       (idx < MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION) && cursor != num_events;
+       idx++) {
+    long c = cursor++;
+    io_uring_event* ev = &g_ring.events[c];
+    void* data_ptr = reinterpret_cast<void*>(ev->user_data);
+    bool terminated = (ev->flags & IORING_CQE_F_MORE) == 0;
+
+    if (data_ptr == &g_io_uring_ignore_tag ||
+        data_ptr == &g_io_uring_probe_tag) {
+      continue;
+    } else if (data_ptr == &global_wakeup_fd) {
+      append_error(&error, grpc_wakeup_fd_consume_wakeup(&global_wakeup_fd),
+                   err_desc);
+      if (terminated) {
+        io_uring_arm_poll(global_wakeup_fd.read_fd, &global_wakeup_fd);
+      }
+    } else {
+      if (ev->res >= 0) {
+        process_fd_events(data_ptr, static_cast<uint32_t>(ev->res));
+      } else if (ev->res != -ECANCELED) {
+        /* Let the owner of the fd discover the failure through its syscalls */
+        process_fd_events(data_ptr, EPOLLERR | EPOLLHUP);
+      }
+      if (terminated) {
+        fd_io_uring_poll_terminated(
+            reinterpret_cast<grpc_fd*>(reinterpret_cast<intptr_t>(data_ptr) &
+                                       ~static_cast<intptr_t>(1)),
+            ev->res);
+      }
+    }
+  }
+  gpr_atm_rel_store(&g_epoll_set.cursor, cursor);
+  return error;
+}
+
+/* io_uring counterpart of do_epoll_wait(): reaps completions into
+   g_ring.events, entering the kernel only if the completion ring is empty.
+   Same synchronization rules apply. */
+static grpc_error* do_io_uring_wait(grpc_pollset* ps, grpc_millis deadline) {
+  GPR_TIMER_SCOPE("do_io_uring_wait", 0);
+
+  int r = io_uring_reap_events();
+  if (r == 0) {
+    int timeout = poll_deadline_to_millis_timeout(deadline);
+    /* Completions that did not fit in the ring are only flushed to it by
+       io_uring_enter() */
+    bool overflowed = (__atomic_load_n(g_ring.sq_flags, __ATOMIC_ACQUIRE) &
+                       IORING_SQ_CQ_OVERFLOW) != 0;
+    if (timeout != 0 || overflowed) {
+      struct __kernel_timespec ts;
+      struct io_uring_getevents_arg arg;
+      memset(&arg, 0, sizeof(arg));
+      if (timeout > 0) {
+        ts.tv_sec = timeout / GPR_MS_PER_SEC;
+        ts.tv_nsec = (timeout % GPR_MS_PER_SEC) * GPR_NS_PER_MS;
+        arg.ts = reinterpret_cast<uint64_t>(&ts);
+      } else if (timeout == 0) {
+        ts.tv_sec = 0;
+        ts.tv_nsec = 0;
+        arg.ts = reinterpret_cast<uint64_t>(&ts);
+      }
+      int ret;
+      if (timeout != 0) {
+        GRPC_SCHEDULING_START_BLOCKING_REGION;
+      }
+      do {
+        GRPC_STATS_INC_SYSCALL_POLL();
+        ret = sys_io_uring_enter(
+            g_ring.ring_fd, 0, 1,
+            IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+      } while (ret < 0 && errno == EINTR);
+      if (timeout != 0) {
+        GRPC_SCHEDULING_END_BLOCKING_REGION;
+      }
+      if (ret < 0 && errno != ETIME && errno != EBUSY) {
+        return GRPC_OS_ERROR(errno, "io_uring_enter");
+      }
+      r = io_uring_reap_events();
+    }
+  }
+
+  GRPC_STATS_INC_POLL_EVENTS_RETURNED(r);
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
+    gpr_log(GPR_INFO, "ps: %p poll got %d events", ps, r);
+  }
+
+  gpr_atm_rel_store(&g_epoll_set.num_events, r);
+  gpr_atm_rel_store(&g_epoll_set.cursor, 0);
+
+  return GRPC_ERROR_NONE;
+}
+
+#else /* defined(GRPC_IO_URING_EV) */
+
+static grpc_error* process_io_uring_events(grpc_pollset* /*pollset*/) {
+  return GRPC_ERROR_NONE;
+}
+
+static grpc_error* do_io_uring_wait(grpc_pollset* /*ps*/,
+                                    grpc_millis /*deadline*/) {
+  return GRPC_ERROR_NONE;
+}
+
+#endif /* defined(GRPC_IO_URING_EV) */
+
 static bool begin_worker(grpc_pollset* pollset, grpc_pollset_worker* worker,
                          grpc_pollset_worker** worker_hdl,
                          grpc_millis deadline) {
@@ -1049,9 +1634,15 @@ static grpc_error* pollset_work(grpc_pollset* ps,
        without a designated poller */
     if (gpr_atm_acq_load(&g_epoll_set.cursor) ==
         gpr_atm_acq_load(&g_epoll_set.num_events)) {
-      append_error(&error, do_epoll_wait(ps, deadline), err_desc);
+      append_error(&error,
+                   g_use_io_uring ? do_io_uring_wait(ps, deadline)
+                                  : do_epoll_wait(ps, deadline),
+                   err_desc);
     }
-    append_error(&error, process_epoll_events(ps), err_desc);
+    append_error(&error,
+                 g_use_io_uring ? process_io_uring_events(ps)
+                                : process_epoll_events(ps),
+                 err_desc);
 
     gpr_mu_lock(&ps->mu); /* lock */
 
@@ -1264,10 +1855,19 @@ static bool add_closure_to_background_poller(grpc_closure* /*closure*/,
   return false;
 }
 
+static void event_source_shutdown() {
+  if (g_use_io_uring) {
+    io_uring_shutdown();
+    g_use_io_uring = false;
+  } else {
+    epoll_set_shutdown();
+  }
+}
+
 static void shutdown_engine(void) {
   fd_global_shutdown();
   pollset_global_shutdown();
-  epoll_set_shutdown();
+  event_source_shutdown();
   if (grpc_core::Fork::Enabled()) {
     gpr_mu_destroy(&fork_fd_list_mu);
     grpc_core::Fork::SetResetChildPollingEngineFunc(nullptr);
@@ -1324,8 +1924,31 @@ static void reset_event_manager_on_fork() {
     fork_fd_list_head = fork_fd_list_head->fork_fd_list->next;
   }
   gpr_mu_unlock(&fork_fd_list_mu);
+  bool use_io_uring = g_use_io_uring;
   shutdown_engine();
-  grpc_init_epoll1_linux(true);
+  if (use_io_uring) {
+    grpc_init_io_uring_linux(true);
+  } else {
+    grpc_init_epoll1_linux(true);
+  }
+}
+
+/* Common part of engine initialization, once the event source is set up */
+static const grpc_event_engine_vtable* init_engine() {
+  fd_global_init();
+
+  if (!GRPC_LOG_IF_ERROR("pollset_global_init", pollset_global_init())) {
+    fd_global_shutdown();
+    event_source_shutdown();
+    return nullptr;
+  }
+
+  if (grpc_core::Fork::Enabled()) {
+    gpr_mu_init(&fork_fd_list_mu);
+    grpc_core::Fork::SetResetChildPollingEngineFunc(
+        reset_event_manager_on_fork);
+  }
+  return &vtable;
 }
 
 /* It is possible that GLIBC has epoll but the underlying kernel doesn't.
@@ -1341,23 +1964,36 @@ const grpc_event_engine_vtable* grpc_init_epoll1_linux(
   if (!epoll_set_init()) {
     return nullptr;
   }
+  g_busy_poll_us = GPR_MAX(GPR_GLOBAL_CONFIG_GET(grpc_poll_busy_poll_us), 0);
 
-  fd_global_init();
+  return init_engine();
+}
 
-  if (!GRPC_LOG_IF_ERROR("pollset_global_init", pollset_global_init())) {
-    fd_global_shutdown();
-    epoll_set_shutdown();
+/* The io_uring engine is only used when explicitly requested. If the kernel
+ * (or the headers gRPC was built against) lack the io_uring features it needs,
+ * the engine falls back to plain epoll1. */
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(
+    bool explicit_request) {
+  if (!explicit_request) {
     return nullptr;
   }
 
-  if (grpc_core::Fork::Enabled()) {
-    gpr_mu_init(&fork_fd_list_mu);
-    grpc_core::Fork::SetResetChildPollingEngineFunc(
-        reset_event_manager_on_fork);
+  if (!grpc_has_wakeup_fd()) {
+    gpr_log(GPR_ERROR, "Skipping io_uring because of no wakeup fd.");
+    return nullptr;
   }
-  return &vtable;
+
+  if (!io_uring_init()) {
+    gpr_log(GPR_INFO, "io_uring unavailable, falling back to epoll1");
+    return grpc_init_epoll1_linux(explicit_request);
+  }
+  g_use_io_uring = true;
+
+  return init_engine();
 }
 
+bool grpc_io_uring_linux_in_use() { return g_use_io_uring; }
+
 #else /* defined(GRPC_LINUX_EPOLL) */
 #if defined(GRPC_POSIX_SOCKET_EV_EPOLL1)
 #include "src/core/lib/iomgr/ev_epoll1_linux.h"
@@ -1367,5 +2003,10 @@ const grpc_event_engine_vtable* grpc_init_epoll1_linux(
     bool /*explicit_request*/) {
   return nullptr;
 }
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(
+    bool /*explicit_request*/) {
+  return nullptr;
+}
+bool grpc_io_uring_linux_in_use() { return false; }
 #endif /* defined(GRPC_POSIX_SOCKET_EV_EPOLL1) */
 #endif /* !defined(GRPC_LINUX_EPOLL) */
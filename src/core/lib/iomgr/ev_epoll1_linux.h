@@ -28,4 +28,12 @@
 
 const grpc_event_engine_vtable* grpc_init_epoll1_linux(bool explicit_request);
 
+// the same engine, but watching fds with multishot io_uring polls instead of
+// the epoll set; only used when requested by name
+const grpc_event_engine_vtable* grpc_init_io_uring_linux(bool explicit_request);
+
+// true if the engine watches fds through io_uring, i.e. it was requested and
+// did not fall back to epoll (for tests)
+bool grpc_io_uring_linux_in_use();
+
 #endif /* GRPC_CORE_LIB_IOMGR_EV_EPOLL1_LINUX_H */
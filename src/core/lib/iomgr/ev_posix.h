@@ -31,6 +31,7 @@
 #include "src/core/lib/iomgr/wakeup_fd_posix.h"
 
 GPR_GLOBAL_CONFIG_DECLARE_STRING(grpc_poll_strategy);
+GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_poll_busy_poll_us);
 
 extern grpc_core::DebugOnlyTraceFlag grpc_fd_trace; /* Disabled by default */
 extern grpc_core::DebugOnlyTraceFlag
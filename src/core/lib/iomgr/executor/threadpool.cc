@@ -20,8 +20,22 @@
 
 #include "src/core/lib/iomgr/executor/threadpool.h"
 
+#include "src/core/lib/gpr/tls.h"
+
 namespace grpc_core {
 
+namespace {
+// For thread pools, default stack size for mobile platform is 1952K. for other
+// platforms is 64K.
+size_t DefaultThreadPoolStackSize() {
+#if defined(__ANDROID__) || defined(__APPLE__)
+  return 1952 * 1024;
+#else
+  return 64 * 1024;
+#endif
+}
+}  // namespace
+
 void ThreadPoolWorker::Run() {
   while (true) {
     void* elem;
@@ -63,13 +77,7 @@ void ThreadPool::SharedThreadPoolConstructor() {
   }
 }
 
-size_t ThreadPool::DefaultStackSize() {
-#if defined(__ANDROID__) || defined(__APPLE__)
-  return 1952 * 1024;
-#else
-  return 64 * 1024;
-#endif
-}
+size_t ThreadPool::DefaultStackSize() { return DefaultThreadPoolStackSize(); }
 
 void ThreadPool::AssertHasNotBeenShutDown() {
   // For debug checking purpose, using RELAXED order is sufficient.
@@ -134,4 +142,247 @@ const Thread::Options& ThreadPool::thread_options() const {
 }
 
 const char* ThreadPool::thread_name() const { return thd_name_; }
+
+namespace {
+// The WorkStealingThreadPool worker running on the current thread, if any.
+GPR_TLS_DECL(g_current_worker);
+}  // namespace
+
+// Bounded Chase-Lev deque (Le et al., "Correct and Efficient Work-Stealing for
+// Weak Memory Models"). Push and Pop may only be called by the owning worker;
+// Steal may be called by any thread.
+class WorkStealingThreadPool::Deque {
+ public:
+  static constexpr int64_t kCapacity = 1024;  // Must be a power of 2
+
+  Deque() {
+    for (auto& slot : buffer_) slot.store(nullptr, std::memory_order_relaxed);
+  }
+
+  // Returns false if the deque is full.
+  bool Push(grpc_experimental_completion_queue_functor* closure) {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_acquire);
+    if (b - t >= kCapacity) return false;
+    buffer_[b & (kCapacity - 1)].store(closure, std::memory_order_relaxed);
+    bottom_.store(b + 1, std::memory_order_release);
+    return true;
+  }
+
+  grpc_experimental_completion_queue_functor* Pop() {
+    int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    // The seq_cst store/load pair stands in for the paper's full fence (which
+    // TSAN cannot model): thieves must observe the reservation of slot b
+    // before we read top_.
+    bottom_.store(b, std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_seq_cst);
+    if (t > b) {
+      // Empty.
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    grpc_experimental_completion_queue_functor* closure =
+        buffer_[b & (kCapacity - 1)].load(std::memory_order_relaxed);
+    if (t == b) {
+      // Last element: race against thieves for it.
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        closure = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return closure;
+  }
+
+  // Returns nullptr if the deque is empty or another thread won the race.
+  grpc_experimental_completion_queue_functor* Steal() {
+    int64_t t = top_.load(std::memory_order_seq_cst);
+    int64_t b = bottom_.load(std::memory_order_seq_cst);
+    if (t >= b) return nullptr;
+    grpc_experimental_completion_queue_functor* closure =
+        buffer_[t & (kCapacity - 1)].load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return closure;
+  }
+
+ private:
+  std::atomic<int64_t> top_{0};
+  std::atomic<int64_t> bottom_{0};
+  std::atomic<grpc_experimental_completion_queue_functor*> buffer_[kCapacity];
+};
+
+class WorkStealingThreadPool::Worker {
+ public:
+  Worker(WorkStealingThreadPool* pool, int index)
+      : pool_(pool), index_(index) {
+    thd_ = Thread(
+        pool->thd_name_, [](void* th) { static_cast<Worker*>(th)->Run(); },
+        this, nullptr, pool->thread_options_);
+  }
+
+  void Start() { thd_.Start(); }
+  void Join() { thd_.Join(); }
+
+  WorkStealingThreadPool* pool() const { return pool_; }
+  int index() const { return index_; }
+  Deque* deque() { return &deque_; }
+
+ private:
+  void Run();
+
+  WorkStealingThreadPool* const pool_;
+  const int index_;
+  Deque deque_;
+  Thread thd_;
+};
+
+void WorkStealingThreadPool::Worker::Run() {
+  gpr_tls_set(&g_current_worker, reinterpret_cast<intptr_t>(this));
+  while (true) {
+    grpc_experimental_completion_queue_functor* closure =
+        pool_->FindWork(this);
+    if (closure != nullptr) {
+      pool_->num_pending_.fetch_sub(1, std::memory_order_relaxed);
+      closure->functor_run(closure, closure->internal_success);
+      continue;
+    }
+    MutexLock lock(&pool_->mu_);
+    // Announce the intent to park before re-checking for work, so that a
+    // concurrent Add() either sees us parked or we see its closure.
+    pool_->num_parked_.fetch_add(1, std::memory_order_seq_cst);
+    while (pool_->num_pending_.load(std::memory_order_seq_cst) <= 0 &&
+           !pool_->shut_down_) {
+      pool_->cv_.Wait(&pool_->mu_);
+    }
+    pool_->num_parked_.fetch_sub(1, std::memory_order_relaxed);
+    if (pool_->shut_down_ &&
+        pool_->num_pending_.load(std::memory_order_seq_cst) <= 0) {
+      break;
+    }
+  }
+  gpr_tls_set(&g_current_worker, 0);
+}
+
+void WorkStealingThreadPool::GlobalInit() { gpr_tls_init(&g_current_worker); }
+
+WorkStealingThreadPool::WorkStealingThreadPool(int num_threads)
+    : num_threads_(num_threads), thd_name_("WorkStealingThreadPoolWorker") {
+  thread_options_.set_stack_size(DefaultThreadPoolStackSize());
+  SharedConstructor();
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(int num_threads,
+                                               const char* thd_name)
+    : num_threads_(num_threads), thd_name_(thd_name) {
+  thread_options_.set_stack_size(DefaultThreadPoolStackSize());
+  SharedConstructor();
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+    int num_threads, const char* thd_name,
+    const Thread::Options& thread_options)
+    : num_threads_(num_threads),
+      thd_name_(thd_name),
+      thread_options_(thread_options) {
+  if (thread_options_.stack_size() == 0) {
+    thread_options_.set_stack_size(DefaultThreadPoolStackSize());
+  }
+  SharedConstructor();
+}
+
+void WorkStealingThreadPool::SharedConstructor() {
+  // All worker threads in thread pool must be joinable.
+  thread_options_.set_joinable(true);
+
+  // Create at least 1 worker thread.
+  if (num_threads_ <= 0) num_threads_ = 1;
+
+  workers_ = static_cast<Worker**>(gpr_zalloc(num_threads_ * sizeof(Worker*)));
+  for (int i = 0; i < num_threads_; ++i) {
+    workers_[i] = new Worker(this, i);
+  }
+  // Only start once every worker exists, since workers steal from each other.
+  for (int i = 0; i < num_threads_; ++i) {
+    workers_[i]->Start();
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  {
+    MutexLock lock(&mu_);
+    shut_down_ = true;
+    cv_.SignalAll();
+  }
+  for (int i = 0; i < num_threads_; ++i) {
+    workers_[i]->Join();
+  }
+  for (int i = 0; i < num_threads_; ++i) {
+    delete workers_[i];
+  }
+  gpr_free(workers_);
+}
+
+void WorkStealingThreadPool::Add(
+    grpc_experimental_completion_queue_functor* closure) {
+  Worker* worker = reinterpret_cast<Worker*>(gpr_tls_get(&g_current_worker));
+  if (worker != nullptr && worker->pool() == this &&
+      worker->deque()->Push(closure)) {
+    num_pending_.fetch_add(1, std::memory_order_seq_cst);
+    if (num_parked_.load(std::memory_order_seq_cst) > 0) {
+      WakeOneWorker();
+    }
+    return;
+  }
+  MutexLock lock(&mu_);
+  GPR_DEBUG_ASSERT(!shut_down_ || worker != nullptr);
+  injected_.push_back(closure);
+  num_injected_.fetch_add(1, std::memory_order_relaxed);
+  num_pending_.fetch_add(1, std::memory_order_seq_cst);
+  if (num_parked_.load(std::memory_order_seq_cst) > 0) {
+    cv_.Signal();
+  }
+}
+
+void WorkStealingThreadPool::WakeOneWorker() {
+  MutexLock lock(&mu_);
+  cv_.Signal();
+}
+
+grpc_experimental_completion_queue_functor* WorkStealingThreadPool::FindWork(
+    Worker* worker) {
+  grpc_experimental_completion_queue_functor* closure = worker->deque()->Pop();
+  if (closure != nullptr) return closure;
+  if (num_injected_.load(std::memory_order_relaxed) > 0) {
+    MutexLock lock(&mu_);
+    if (!injected_.empty()) {
+      closure = injected_.front();
+      injected_.pop_front();
+      num_injected_.fetch_sub(1, std::memory_order_relaxed);
+      return closure;
+    }
+  }
+  for (int i = 1; i < num_threads_; ++i) {
+    Worker* victim = workers_[(worker->index() + i) % num_threads_];
+    closure = victim->deque()->Steal();
+    if (closure != nullptr) return closure;
+  }
+  return nullptr;
+}
+
+int WorkStealingThreadPool::num_pending_closures() const {
+  int pending = num_pending_.load(std::memory_order_relaxed);
+  return pending > 0 ? pending : 0;
+}
+
+int WorkStealingThreadPool::pool_capacity() const { return num_threads_; }
+
+const Thread::Options& WorkStealingThreadPool::thread_options() const {
+  return thread_options_;
+}
+
+const char* WorkStealingThreadPool::thread_name() const { return thd_name_; }
+
 }  // namespace grpc_core
@@ -56,6 +56,9 @@
 /* Linux has TCP_INQ support since 4.18, but it is safe to set
    the socket option on older kernels. */
 #define GRPC_HAVE_TCP_INQ 1
+/* Linux has TCP_ZEROCOPY_RECEIVE support since 4.18. On older kernels the
+   socket option fails and the endpoint goes back to copying reads. */
+#define GRPC_HAVE_TCP_ZEROCOPY_RECEIVE 1
 #ifdef LINUX_VERSION_CODE
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
@@ -91,6 +94,11 @@
 #define GRPC_LINUX_EVENTFD 1
 #define GRPC_MSG_IOVLEN_TYPE int
 #endif
+#if defined(__has_include) && !defined(GPR_NO_DIRECT_SYSCALLS)
+#if __has_include(<linux/io_uring.h>)
+#define GRPC_LINUX_IO_URING 1
+#endif
+#endif
 #ifndef GRPC_LINUX_EVENTFD
 #define GRPC_POSIX_NO_SPECIAL_WAKEUP_FD 1
 #endif
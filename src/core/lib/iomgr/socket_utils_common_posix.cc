@@ -209,6 +209,19 @@ grpc_error* grpc_set_socket_reuse_port(int fd, int reuse) {
 #endif
 }
 
+/* set a listening socket's preferred cpu */
+grpc_error* grpc_set_socket_incoming_cpu(int fd, int cpu) {
+#ifndef SO_INCOMING_CPU
+  return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+      "SO_INCOMING_CPU unavailable on compiling system");
+#else
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, sizeof(cpu))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_INCOMING_CPU)");
+  }
+  return GRPC_ERROR_NONE;
+#endif
+}
+
 static gpr_once g_probe_so_reuesport_once = GPR_ONCE_INIT;
 static int g_support_so_reuseport = false;
 
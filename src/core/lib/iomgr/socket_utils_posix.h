@@ -65,6 +65,10 @@ grpc_error* grpc_set_socket_low_latency(int fd, int low_latency);
 /* set SO_REUSEPORT */
 grpc_error* grpc_set_socket_reuse_port(int fd, int reuse);
 
+/* set SO_INCOMING_CPU: among a group of SO_REUSEPORT listeners, prefer the
+   one whose cpu matches the cpu that received the connection */
+grpc_error* grpc_set_socket_incoming_cpu(int fd, int cpu);
+
 /* Configure the default values for TCP_USER_TIMEOUT */
 void config_default_tcp_user_timeout(bool enable, int timeout, bool is_client);
 
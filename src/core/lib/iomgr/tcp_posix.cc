@@ -32,6 +32,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -69,6 +70,10 @@
 #define TCP_CM_INQ TCP_INQ
 #endif
 
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+
 #ifdef GRPC_HAVE_MSG_NOSIGNAL
 #define SENDMSG_FLAGS MSG_NOSIGNAL
 #else
@@ -92,6 +97,17 @@ typedef size_t msg_iovlen_type;
 
 extern grpc_core::TraceFlag grpc_tcp_trace;
 
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+// Leading fields of the kernel's struct tcp_zerocopy_receive, which every
+// kernel that supports TCP_ZEROCOPY_RECEIVE accepts. Declared here because
+// <linux/tcp.h> cannot be included alongside <netinet/tcp.h>.
+struct tcp_zerocopy_receive_args {
+  uint64_t address;         // in: start of the mapping
+  uint32_t length;          // in: bytes to map, out: bytes mapped
+  uint32_t recv_skip_hint;  // out: bytes to read with recvmsg() instead
+};
+#endif /* GRPC_HAVE_TCP_ZEROCOPY_RECEIVE */
+
 namespace grpc_core {
 
 class TcpZerocopySendRecord {
@@ -385,6 +401,17 @@ struct grpc_tcp {
   grpc_closure* release_fd_cb;
   int* release_fd;
 
+  /* Receive zerocopy: reads of at least rx_zerocopy_threshold bytes map the
+   * received pages into the incoming slices instead of copying them. */
+  bool rx_zerocopy_enabled;
+  size_t rx_zerocopy_threshold;
+  /* Bytes the kernel could not map on the last zerocopy read. They have to
+   * be consumed by recvmsg() before mapping can make progress again. */
+  size_t rx_zerocopy_skip;
+  /* Consecutive zerocopy reads that found data but could not map any of it,
+   * e.g. because the driver does not split headers from payload. */
+  int rx_zerocopy_misses;
+
   grpc_closure read_done_closure;
   grpc_closure write_done_closure;
   grpc_closure error_closure;
@@ -850,6 +877,93 @@ static void tcp_do_read(grpc_tcp* tcp) {
   TCP_UNREF(tcp, "read");
 }
 
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+/* Give up on receive zerocopy after this many reads in a row could not map a
+ * single page, as each attempt costs an mmap() and a getsockopt(). */
+static constexpr int kMaxRxZerocopyMisses = 32;
+
+static void tcp_zerocopy_unmap(void* p, size_t len) { munmap(p, len); }
+
+/* Tries to receive up to \a target_read_size bytes by mapping them from the
+ * socket rather than copying them. Returns false without having consumed
+ * anything if no whole page could be mapped; the caller then falls back to
+ * tcp_do_read(), which also takes care of EAGAIN and end of stream. */
+static bool tcp_do_zerocopy_read(grpc_tcp* tcp, size_t target_read_size) {
+  GPR_TIMER_SCOPE("tcp_do_zerocopy_read", 0);
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t map_len = target_read_size & ~(page_size - 1);
+  if (map_len == 0) return false;
+
+  void* addr = mmap(nullptr, map_len, PROT_READ, MAP_SHARED, tcp->fd, 0);
+  if (addr == MAP_FAILED) {
+    /* Not a TCP socket, or a kernel without receive zerocopy */
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
+      gpr_log(GPR_INFO, "TCP:%p rx zerocopy disabled: mmap errno=%d", tcp,
+              errno);
+    }
+    tcp->rx_zerocopy_enabled = false;
+    return false;
+  }
+
+  tcp_zerocopy_receive_args zc;
+  memset(&zc, 0, sizeof(zc));
+  zc.address = reinterpret_cast<uintptr_t>(addr);
+  zc.length = static_cast<uint32_t>(map_len);
+  socklen_t zc_len = sizeof(zc);
+  int err;
+  do {
+    GPR_TIMER_SCOPE("getsockopt", 0);
+    GRPC_STATS_INC_SYSCALL_READ();
+    err = getsockopt(tcp->fd, SOL_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (err < 0 && errno == EINTR);
+
+  if (err < 0 || zc.length == 0) {
+    /* EIO is how the kernel reports end of stream; recvmsg() will see it too.
+     * Anything else means zerocopy is not usable on this socket. */
+    if (err < 0 && errno != EIO) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
+        gpr_log(GPR_INFO, "TCP:%p rx zerocopy disabled: getsockopt errno=%d",
+                tcp, errno);
+      }
+      tcp->rx_zerocopy_enabled = false;
+    }
+    munmap(addr, map_len);
+    if (err == 0 && zc.recv_skip_hint > 0 &&
+        ++tcp->rx_zerocopy_misses >= kMaxRxZerocopyMisses) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
+        gpr_log(GPR_INFO, "TCP:%p rx zerocopy disabled: no mappable data",
+                tcp);
+      }
+      tcp->rx_zerocopy_enabled = false;
+    }
+    return false;
+  }
+  tcp->rx_zerocopy_misses = 0;
+  if (zc.length < map_len) {
+    munmap(static_cast<char*>(addr) + zc.length, map_len - zc.length);
+  }
+
+  GRPC_STATS_INC_TCP_READ_SIZE(zc.length);
+  add_to_estimate(tcp, zc.length);
+  tcp->rx_zerocopy_skip = zc.recv_skip_hint;
+  /* Either the kernel left bytes behind or it filled the whole mapping: in
+   * both cases there is probably more to read. */
+  tcp->inq = (zc.recv_skip_hint > 0 || zc.length == map_len) ? 1 : 0;
+  if (tcp->inq == 0) {
+    finish_estimate(tcp);
+  }
+
+  /* Keep any preallocated buffers around for the next copying read. */
+  grpc_slice_buffer_move_into(tcp->incoming_buffer, &tcp->last_read_buffer);
+  grpc_slice_buffer_add(
+      tcp->incoming_buffer,
+      grpc_slice_new_with_len(addr, zc.length, tcp_zerocopy_unmap));
+  call_read_cb(tcp, GRPC_ERROR_NONE);
+  TCP_UNREF(tcp, "read");
+  return true;
+}
+#endif /* GRPC_HAVE_TCP_ZEROCOPY_RECEIVE */
+
 static void tcp_read_allocation_done(void* tcpp, grpc_error* error) {
   grpc_tcp* tcp = static_cast<grpc_tcp*>(tcpp);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
@@ -868,6 +982,19 @@ static void tcp_read_allocation_done(void* tcpp, grpc_error* error) {
 
 static void tcp_continue_read(grpc_tcp* tcp) {
   size_t target_read_size = get_target_read_size(tcp);
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+  /* Small reads and bytes the kernel declined to map are copied. */
+  if (tcp->rx_zerocopy_enabled && tcp->rx_zerocopy_skip == 0 &&
+      target_read_size >= tcp->rx_zerocopy_threshold) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace)) {
+      gpr_log(GPR_INFO, "TCP:%p do_zerocopy_read", tcp);
+    }
+    if (tcp_do_zerocopy_read(tcp, target_read_size)) {
+      return;
+    }
+  }
+  tcp->rx_zerocopy_skip = 0;
+#endif /* GRPC_HAVE_TCP_ZEROCOPY_RECEIVE */
   /* Wait for allocation only when there is no buffer left. */
   if (tcp->incoming_buffer->length == 0 &&
       tcp->incoming_buffer->count < MAX_READ_IOVEC) {
@@ -1694,6 +1821,8 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
                                const grpc_channel_args* channel_args,
                                const char* peer_string) {
   static constexpr bool kZerocpTxEnabledDefault = false;
+  static constexpr bool kZerocpRxEnabledDefault = false;
+  static constexpr int kZerocpRxRecvBytesThresholdDefault = 64 * 1024;
   int tcp_read_chunk_size = GRPC_TCP_DEFAULT_READ_SLICE_SIZE;
   int tcp_max_read_chunk_size = 4 * 1024 * 1024;
   int tcp_min_read_chunk_size = 256;
@@ -1702,6 +1831,8 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
       grpc_core::TcpZerocopySendCtx::kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simult_sends =
       grpc_core::TcpZerocopySendCtx::kDefaultMaxSends;
+  bool tcp_rx_zerocopy_enabled = kZerocpRxEnabledDefault;
+  int tcp_rx_zerocopy_recv_bytes_thresh = kZerocpRxRecvBytesThresholdDefault;
   grpc_resource_quota* resource_quota = grpc_resource_quota_create(nullptr);
   if (channel_args != nullptr) {
     for (size_t i = 0; i < channel_args->num_args; i++) {
@@ -1743,6 +1874,16 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
             grpc_core::TcpZerocopySendCtx::kDefaultMaxSends, 0, INT_MAX};
         tcp_tx_zerocopy_max_simult_sends =
             grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) {
+        tcp_rx_zerocopy_enabled = grpc_channel_arg_get_bool(
+            &channel_args->args[i], kZerocpRxEnabledDefault);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD)) {
+        grpc_integer_options options = {kZerocpRxRecvBytesThresholdDefault, 0,
+                                        INT_MAX};
+        tcp_rx_zerocopy_recv_bytes_thresh =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
       }
     }
   }
@@ -1796,6 +1937,15 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
     }
 #endif
   }
+#ifdef GRPC_HAVE_TCP_ZEROCOPY_RECEIVE
+  tcp->rx_zerocopy_enabled = tcp_rx_zerocopy_enabled;
+#else
+  tcp->rx_zerocopy_enabled = false;
+#endif /* GRPC_HAVE_TCP_ZEROCOPY_RECEIVE */
+  tcp->rx_zerocopy_threshold =
+      static_cast<size_t>(tcp_rx_zerocopy_recv_bytes_thresh);
+  tcp->rx_zerocopy_skip = 0;
+  tcp->rx_zerocopy_misses = 0;
   /* paired with unref in grpc_tcp_destroy */
   new (&tcp->refcount) grpc_core::RefCount(
       1, GRPC_TRACE_FLAG_ENABLED(grpc_tcp_trace) ? "tcp" : nullptr);
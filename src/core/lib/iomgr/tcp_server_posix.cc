@@ -43,6 +43,7 @@
 #include "absl/strings/str_format.h"
 
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
@@ -67,6 +68,8 @@ static grpc_error* tcp_server_create(grpc_closure* shutdown_complete,
       static_cast<grpc_tcp_server*>(gpr_zalloc(sizeof(grpc_tcp_server)));
   s->so_reuseport = grpc_is_socket_reuse_port_supported();
   s->expand_wildcard_addrs = false;
+  s->listener_affinity = false;
+  s->listener_incoming_cpu = false;
   for (size_t i = 0; i < (args == nullptr ? 0 : args->num_args); i++) {
     if (0 == strcmp(GRPC_ARG_ALLOW_REUSEPORT, args->args[i].key)) {
       if (args->args[i].type == GRPC_ARG_INTEGER) {
@@ -85,6 +88,23 @@ static grpc_error* tcp_server_create(grpc_closure* shutdown_complete,
         return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
             GRPC_ARG_EXPAND_WILDCARD_ADDRS " must be an integer");
       }
+    } else if (0 == strcmp(GRPC_ARG_TCP_LISTENER_AFFINITY, args->args[i].key)) {
+      if (args->args[i].type == GRPC_ARG_INTEGER) {
+        s->listener_affinity = (args->args[i].value.integer != 0);
+      } else {
+        gpr_free(s);
+        return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            GRPC_ARG_TCP_LISTENER_AFFINITY " must be an integer");
+      }
+    } else if (0 == strcmp(GRPC_ARG_TCP_LISTENER_INCOMING_CPU,
+                           args->args[i].key)) {
+      if (args->args[i].type == GRPC_ARG_INTEGER) {
+        s->listener_incoming_cpu = (args->args[i].value.integer != 0);
+      } else {
+        gpr_free(s);
+        return GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            GRPC_ARG_TCP_LISTENER_INCOMING_CPU " must be an integer");
+      }
     }
   }
   gpr_ref_init(&s->refs, 1);
@@ -247,10 +267,15 @@ static void on_read(void* arg, grpc_error* err) {
     std::string name = absl::StrCat("tcp-server-connection:", addr_str);
     grpc_fd* fdobj = grpc_fd_create(fd, name.c_str(), true);
 
-    read_notifier_pollset = (*(sp->server->pollsets))
-        [static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
-             &sp->server->next_pollset_to_assign, 1)) %
-         sp->server->pollsets->size()];
+    if (sp->pollset != nullptr) {
+      /* keep the connection on the pollset that accepted it */
+      read_notifier_pollset = sp->pollset;
+    } else {
+      read_notifier_pollset = (*(sp->server->pollsets))
+          [static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
+               &sp->server->next_pollset_to_assign, 1)) %
+           sp->server->pollsets->size()];
+    }
 
     grpc_pollset_add_fd(read_notifier_pollset, fdobj);
 
@@ -508,6 +533,15 @@ static void tcp_server_start(grpc_tcp_server* s,
           "clone_port", clone_port(sp, (unsigned)(pollsets->size() - 1))));
       for (i = 0; i < pollsets->size(); i++) {
         grpc_pollset_add_fd((*pollsets)[i], sp->emfd);
+        /* each clone is polled by exactly one pollset: with affinity, that
+           pollset also owns everything the clone accepts */
+        sp->pollset = s->listener_affinity ? (*pollsets)[i] : nullptr;
+        if (s->listener_affinity && s->listener_incoming_cpu) {
+          GRPC_LOG_IF_ERROR(
+              "listener_incoming_cpu",
+              grpc_set_socket_incoming_cpu(
+                  sp->fd, static_cast<int>(i % gpr_cpu_num_cores())));
+        }
         GRPC_CLOSURE_INIT(&sp->read_closure, on_read, sp,
                           grpc_schedule_on_exec_ctx);
         grpc_fd_notify_on_read(sp->emfd, &sp->read_closure);
@@ -518,6 +552,7 @@ static void tcp_server_start(grpc_tcp_server* s,
       for (i = 0; i < pollsets->size(); i++) {
         grpc_pollset_add_fd((*pollsets)[i], sp->emfd);
       }
+      sp->pollset = nullptr;
       GRPC_CLOSURE_INIT(&sp->read_closure, on_read, sp,
                         grpc_schedule_on_exec_ctx);
       grpc_fd_notify_on_read(sp->emfd, &sp->read_closure);
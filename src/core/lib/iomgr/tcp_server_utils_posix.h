@@ -46,6 +46,10 @@ typedef struct grpc_tcp_listener {
      identified while iterating through 'next'. */
   struct grpc_tcp_listener* sibling;
   int is_sibling;
+  /* when listener affinity is enabled, the pollset that every connection
+     accepted on this listener is bound to; otherwise NULL and connections are
+     spread over the server's pollsets */
+  grpc_pollset* pollset;
 } grpc_tcp_listener;
 
 /* the overall server */
@@ -70,6 +74,11 @@ struct grpc_tcp_server {
   bool so_reuseport;
   /* expand wildcard addresses to a list of all local addresses */
   bool expand_wildcard_addrs;
+  /* give each pollset its own SO_REUSEPORT listener and keep the connections
+     it accepts on that pollset */
+  bool listener_affinity;
+  /* steer each pollset's listener to a cpu with SO_INCOMING_CPU */
+  bool listener_incoming_cpu;
 
   /* linked list of server ports */
   grpc_tcp_listener* head;
@@ -19,14 +19,33 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/iomgr/timer.h"
+
+#include <string.h>
+
 #include "src/core/lib/iomgr/timer_manager.h"
 
+GPR_GLOBAL_CONFIG_DEFINE_STRING(
+    grpc_timer_strategy, "generic",
+    "Declares which timer implementation to use: 'generic' (sharded heaps) or "
+    "'wheel' (hierarchical timing wheels).")
+
+extern grpc_timer_vtable grpc_generic_timer_vtable;
+extern grpc_timer_vtable grpc_wheel_timer_vtable;
+
 grpc_timer_vtable* grpc_timer_impl;
 
 void grpc_set_timer_impl(grpc_timer_vtable* vtable) {
   grpc_timer_impl = vtable;
 }
 
+void grpc_set_default_timer_impl() {
+  grpc_core::UniquePtr<char> strategy =
+      GPR_GLOBAL_CONFIG_GET(grpc_timer_strategy);
+  grpc_set_timer_impl(strcmp(strategy.get(), "wheel") == 0
+                          ? &grpc_wheel_timer_vtable
+                          : &grpc_generic_timer_vtable);
+}
+
 void grpc_timer_init(grpc_timer* timer, grpc_millis deadline,
                      grpc_closure* closure) {
   grpc_timer_impl->init(timer, deadline, closure);
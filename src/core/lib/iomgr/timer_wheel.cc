@@ -0,0 +1,414 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#include <inttypes.h>
+
+#include "src/core/lib/iomgr/timer.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/log.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/spinlock.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/atomic.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+/* A hierarchical timing wheel (Varghese & Lauck): WHEEL_LEVELS wheels of
+ * WHEEL_SIZE slots each, where a slot of wheel 'l' spans WHEEL_SIZE^l
+ * milliseconds. A timer goes into the innermost wheel whose span covers the
+ * time left until its deadline, so adding and cancelling a timer is a list
+ * splice. As the clock advances, the slots of the outer wheels it enters are
+ * cascaded down into the inner ones, and the slots of the innermost wheel it
+ * enters are fired. Timers beyond the span of the outermost wheel wait in an
+ * unordered overflow list. */
+
+extern grpc_core::TraceFlag grpc_timer_trace;
+extern grpc_core::TraceFlag grpc_timer_check_trace;
+
+#define WHEEL_BITS 6
+#define WHEEL_SIZE (1 << WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SIZE - 1)
+#define WHEEL_LEVELS 4
+/* Timers further out than this many bits of milliseconds (~4.6 hours) go to
+   the overflow list */
+#define WHEEL_SPAN_BITS (WHEEL_BITS * WHEEL_LEVELS)
+#define OVERFLOW_SLOT 0xffffffffu
+
+/* One timing wheel. Timers are spread across shards by address, as in
+ * timer_generic.cc, so that adds and cancels on different timers rarely
+ * contend. */
+struct wheel_shard {
+  gpr_mu mu;
+  /* All timers with deadlines <= now have fired. */
+  grpc_millis now;
+  /* A lower bound on the deadline of the next timer due in this shard. */
+  grpc_millis min_deadline;
+  /* Bit 'i' of occupied[l] is set iff slot 'i' of wheel 'l' is non-empty. */
+  uint64_t occupied[WHEEL_LEVELS];
+  /* List heads: slot 'i' of wheel 'l' is slots[l * WHEEL_SIZE + i]. */
+  grpc_timer slots[WHEEL_LEVELS * WHEEL_SIZE];
+  grpc_timer overflow;
+};
+static size_t g_num_shards;
+static wheel_shard* g_shards;
+
+static struct {
+  /* The deadline of the next timer due across all shards, or a lower bound
+     on it */
+  grpc_core::Atomic<grpc_millis> min_timer;
+  /* Allow only one check at once */
+  gpr_spinlock checker_mu;
+  bool initialized;
+  /* Serializes updates to min_timer */
+  gpr_mu mu;
+} g_wheel GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE);
+
+static int lowest_set_bit(uint64_t bits) {
+  GPR_DEBUG_ASSERT(bits != 0);
+#if defined(__GNUC__)
+  return __builtin_ctzll(bits);
+#else
+  int i = 0;
+  while ((bits & 1) == 0) {
+    bits >>= 1;
+    i++;
+  }
+  return i;
+#endif
+}
+
+static void list_join(grpc_timer* head, grpc_timer* timer) {
+  timer->next = head;
+  timer->prev = head->prev;
+  timer->next->prev = timer->prev->next = timer;
+}
+
+static void list_remove(grpc_timer* timer) {
+  timer->next->prev = timer->prev;
+  timer->prev->next = timer->next;
+}
+
+/* Moves the timers in the list at 'head' to 'out', leaving 'head' empty. */
+static void list_move(grpc_timer* head, grpc_timer* out) {
+  out->next = out->prev = out;
+  if (head->next == head) return;
+  out->next = head->next;
+  out->prev = head->prev;
+  out->next->prev = out->prev->next = out;
+  head->next = head->prev = head;
+}
+
+/* Files 'timer' into the innermost wheel whose current revolution contains
+   its deadline.
+   REQUIRES: shard->mu locked, timer->deadline > shard->now */
+static void place_timer(wheel_shard* shard, grpc_timer* timer) {
+  const uint64_t diff = static_cast<uint64_t>(timer->deadline) ^
+                        static_cast<uint64_t>(shard->now);
+  for (int level = 0; level < WHEEL_LEVELS; level++) {
+    if ((diff >> (WHEEL_BITS * (level + 1))) == 0) {
+      const uint32_t index =
+          static_cast<uint32_t>(timer->deadline >> (WHEEL_BITS * level)) &
+          WHEEL_MASK;
+      timer->heap_index = level * WHEEL_SIZE + index;
+      list_join(&shard->slots[timer->heap_index], timer);
+      shard->occupied[level] |= uint64_t(1) << index;
+      return;
+    }
+  }
+  timer->heap_index = OVERFLOW_SLOT;
+  list_join(&shard->overflow, timer);
+}
+
+/* Returns the first point in time after shard->now at which a slot needs to
+   be fired or cascaded: the exact deadline of the next timer if it is in the
+   innermost wheel, and a lower bound on it otherwise.
+   REQUIRES: shard->mu locked */
+static grpc_millis next_wheel_event(wheel_shard* shard) {
+  /* Inner wheels only hold timers due before the next slot of the outer
+     ones, so the first non-empty wheel has the earliest event. */
+  for (int level = 0; level < WHEEL_LEVELS; level++) {
+    const int shift = WHEEL_BITS * level;
+    const uint32_t current =
+        static_cast<uint32_t>(shard->now >> shift) & WHEEL_MASK;
+    /* slots after the current one: the clock has already entered the
+       current one */
+    const uint64_t pending =
+        shard->occupied[level] & ~((uint64_t(2) << current) - 1);
+    if (pending != 0) {
+      const grpc_millis revolution_start =
+          (shard->now >> (shift + WHEEL_BITS)) << (shift + WHEEL_BITS);
+      return revolution_start |
+             (static_cast<grpc_millis>(lowest_set_bit(pending)) << shift);
+    }
+  }
+  if (shard->overflow.next != &shard->overflow) {
+    const grpc_millis revolution = shard->now >> WHEEL_SPAN_BITS;
+    if (revolution >= (GRPC_MILLIS_INF_FUTURE >> WHEEL_SPAN_BITS)) {
+      return GRPC_MILLIS_INF_FUTURE;
+    }
+    return (revolution + 1) << WHEEL_SPAN_BITS;
+  }
+  return GRPC_MILLIS_INF_FUTURE;
+}
+
+/* REQUIRES: shard->mu locked */
+static size_t fire_list(grpc_timer* list, grpc_millis now, grpc_error* error) {
+  size_t n = 0;
+  grpc_timer* next;
+  for (grpc_timer* timer = list->next; timer != list; timer = next) {
+    next = timer->next;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+      gpr_log(GPR_INFO, "TIMER %p: FIRE %" PRId64 "ms late", timer,
+              now - timer->deadline);
+    }
+    timer->pending = false;
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure,
+                            GRPC_ERROR_REF(error));
+    n++;
+  }
+  return n;
+}
+
+/* Moves the timers in 'list' to the wheels, or fires them if they are due.
+   REQUIRES: shard->mu locked */
+static size_t cascade_list(wheel_shard* shard, grpc_timer* list) {
+  size_t n = 0;
+  grpc_timer* next;
+  for (grpc_timer* timer = list->next; timer != list; timer = next) {
+    next = timer->next;
+    if (timer->deadline <= shard->now) {
+      timer->pending = false;
+      grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure, GRPC_ERROR_NONE);
+      n++;
+    } else {
+      place_timer(shard, timer);
+    }
+  }
+  return n;
+}
+
+/* Advances the shard's clock to 'now', firing the timers that expire on the
+   way. Returns the number of timers fired.
+   REQUIRES: shard->mu locked */
+static size_t advance_shard(wheel_shard* shard, grpc_millis now) {
+  size_t n = 0;
+  grpc_timer list;
+  for (;;) {
+    const grpc_millis event = next_wheel_event(shard);
+    if (event > now) break;
+    shard->now = event;
+    /* cascade outermost first, so that timers can fall through several
+       wheels at once */
+    if ((event & ((grpc_millis(1) << WHEEL_SPAN_BITS) - 1)) == 0) {
+      list_move(&shard->overflow, &list);
+      n += cascade_list(shard, &list);
+    }
+    for (int level = WHEEL_LEVELS - 1; level >= 0; level--) {
+      const int shift = WHEEL_BITS * level;
+      if ((event & ((grpc_millis(1) << shift) - 1)) != 0) continue;
+      const uint32_t index = static_cast<uint32_t>(event >> shift) & WHEEL_MASK;
+      if ((shard->occupied[level] & (uint64_t(1) << index)) == 0) continue;
+      shard->occupied[level] &= ~(uint64_t(1) << index);
+      list_move(&shard->slots[level * WHEEL_SIZE + index], &list);
+      n += level == 0 ? fire_list(&list, now, GRPC_ERROR_NONE)
+                      : cascade_list(shard, &list);
+    }
+  }
+  if (now > shard->now) shard->now = now;
+  return n;
+}
+
+static void timer_list_init() {
+  g_num_shards = GPR_CLAMP(2 * gpr_cpu_num_cores(), 1, 32);
+  g_shards =
+      static_cast<wheel_shard*>(gpr_zalloc(g_num_shards * sizeof(*g_shards)));
+
+  g_wheel.initialized = true;
+  g_wheel.checker_mu = GPR_SPINLOCK_INITIALIZER;
+  gpr_mu_init(&g_wheel.mu);
+  g_wheel.min_timer.Store(GRPC_MILLIS_INF_FUTURE,
+                          grpc_core::MemoryOrder::RELAXED);
+
+  const grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  for (size_t i = 0; i < g_num_shards; i++) {
+    wheel_shard* shard = &g_shards[i];
+    gpr_mu_init(&shard->mu);
+    shard->now = now;
+    shard->min_deadline = GRPC_MILLIS_INF_FUTURE;
+    for (grpc_timer& head : shard->slots) {
+      head.next = head.prev = &head;
+    }
+    shard->overflow.next = shard->overflow.prev = &shard->overflow;
+  }
+}
+
+static void timer_list_shutdown() {
+  grpc_error* error =
+      GRPC_ERROR_CREATE_FROM_STATIC_STRING("Timer list shutdown");
+  for (size_t i = 0; i < g_num_shards; i++) {
+    wheel_shard* shard = &g_shards[i];
+    for (grpc_timer& head : shard->slots) {
+      fire_list(&head, shard->now, error);
+    }
+    fire_list(&shard->overflow, shard->now, error);
+    gpr_mu_destroy(&shard->mu);
+  }
+  GRPC_ERROR_UNREF(error);
+  gpr_mu_destroy(&g_wheel.mu);
+  gpr_free(g_shards);
+  g_wheel.initialized = false;
+}
+
+static void timer_init(grpc_timer* timer, grpc_millis deadline,
+                       grpc_closure* closure) {
+  wheel_shard* shard = &g_shards[GPR_HASH_POINTER(timer, g_num_shards)];
+  timer->closure = closure;
+  timer->deadline = deadline;
+
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+    gpr_log(GPR_INFO, "TIMER %p: SET %" PRId64 " now %" PRId64 " call %p[%p]",
+            timer, deadline, grpc_core::ExecCtx::Get()->Now(), closure,
+            closure->cb);
+  }
+
+  if (!g_wheel.initialized) {
+    timer->pending = false;
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION, timer->closure,
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            "Attempt to create timer before initialization"));
+    return;
+  }
+
+  gpr_mu_lock(&shard->mu);
+  /* another thread may have moved the shard's clock past our own */
+  if (deadline <= grpc_core::ExecCtx::Get()->Now() || deadline <= shard->now) {
+    timer->pending = false;
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure, GRPC_ERROR_NONE);
+    gpr_mu_unlock(&shard->mu);
+    /* early out */
+    return;
+  }
+  timer->pending = true;
+  place_timer(shard, timer);
+  const bool is_first_timer = deadline < shard->min_deadline;
+  if (is_first_timer) shard->min_deadline = deadline;
+  gpr_mu_unlock(&shard->mu);
+
+  /* As in timer_generic.cc, a check may slip in between the two locks; at
+     worst it recomputes min_timer before we lower it. */
+  if (is_first_timer) {
+    gpr_mu_lock(&g_wheel.mu);
+    if (deadline <
+        g_wheel.min_timer.Load(grpc_core::MemoryOrder::RELAXED)) {
+      g_wheel.min_timer.Store(deadline, grpc_core::MemoryOrder::RELAXED);
+      grpc_kick_poller();
+    }
+    gpr_mu_unlock(&g_wheel.mu);
+  }
+}
+
+static void timer_cancel(grpc_timer* timer) {
+  if (!g_wheel.initialized) {
+    /* must have already been cancelled, also the shard mutex is invalid */
+    return;
+  }
+
+  wheel_shard* shard = &g_shards[GPR_HASH_POINTER(timer, g_num_shards)];
+  gpr_mu_lock(&shard->mu);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_trace)) {
+    gpr_log(GPR_INFO, "TIMER %p: CANCEL pending=%s", timer,
+            timer->pending ? "true" : "false");
+  }
+
+  if (timer->pending) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure,
+                            GRPC_ERROR_CANCELLED);
+    timer->pending = false;
+    list_remove(timer);
+    if (timer->heap_index != OVERFLOW_SLOT) {
+      grpc_timer* head = &shard->slots[timer->heap_index];
+      if (head->next == head) {
+        shard->occupied[timer->heap_index / WHEEL_SIZE] &=
+            ~(uint64_t(1) << (timer->heap_index % WHEEL_SIZE));
+      }
+    }
+    /* shard->min_deadline stays a valid lower bound */
+  }
+  gpr_mu_unlock(&shard->mu);
+}
+
+static grpc_timer_check_result timer_check(grpc_millis* next) {
+  const grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  grpc_millis min_timer =
+      g_wheel.min_timer.Load(grpc_core::MemoryOrder::RELAXED);
+  if (now < min_timer) {
+    if (next != nullptr) *next = GPR_MIN(*next, min_timer);
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+      gpr_log(GPR_INFO, "TIMER CHECK SKIP: now=%" PRId64 " min_timer=%" PRId64,
+              now, min_timer);
+    }
+    return GRPC_TIMERS_CHECKED_AND_EMPTY;
+  }
+  if (!gpr_spinlock_trylock(&g_wheel.checker_mu)) {
+    return GRPC_TIMERS_NOT_CHECKED;
+  }
+
+  grpc_timer_check_result result = GRPC_TIMERS_CHECKED_AND_EMPTY;
+  gpr_mu_lock(&g_wheel.mu);
+  min_timer = GRPC_MILLIS_INF_FUTURE;
+  for (size_t i = 0; i < g_num_shards; i++) {
+    wheel_shard* shard = &g_shards[i];
+    gpr_mu_lock(&shard->mu);
+    if (shard->min_deadline <= now) {
+      const size_t n = advance_shard(shard, now);
+      if (n > 0) result = GRPC_TIMERS_FIRED;
+      shard->min_deadline = next_wheel_event(shard);
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+        gpr_log(GPR_INFO,
+                "  .. shard[%d] popped %" PRIdPTR ", min_deadline --> %" PRId64,
+                static_cast<int>(i), n, shard->min_deadline);
+      }
+    }
+    min_timer = GPR_MIN(min_timer, shard->min_deadline);
+    gpr_mu_unlock(&shard->mu);
+  }
+  g_wheel.min_timer.Store(min_timer, grpc_core::MemoryOrder::RELAXED);
+  gpr_mu_unlock(&g_wheel.mu);
+  gpr_spinlock_unlock(&g_wheel.checker_mu);
+
+  if (next != nullptr) *next = GPR_MIN(*next, min_timer);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_timer_check_trace)) {
+    gpr_log(GPR_INFO, "TIMER CHECK END: r=%d; min_timer=%" PRId64, result,
+            min_timer);
+  }
+  return result;
+}
+
+static void timer_consume_kick(void) {}
+
+grpc_timer_vtable grpc_wheel_timer_vtable = {
+    timer_init,      timer_cancel,        timer_check,
+    timer_list_init, timer_list_shutdown, timer_consume_kick};
@@ -29,6 +29,13 @@
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/slice/slice_internal.h"
 
+/* The vector kernels are compiled with per-function target attributes and
+   selected at runtime, so binaries built for baseline x86 still use them. */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GRPC_BASE64_X86_KERNELS
+#include <immintrin.h>
+#endif
+
 /* --- Constants. --- */
 
 static const int8_t base64_bytes[] = {
@@ -54,6 +61,291 @@ static const char base64_url_safe_chars[] =
 #define GRPC_BASE64_MULTILINE_LINE_LEN 76
 #define GRPC_BASE64_MULTILINE_NUM_BLOCKS (GRPC_BASE64_MULTILINE_LINE_LEN / 4)
 
+/* --- Bulk kernels. --- */
+
+static void encode_triplets_scalar(const uint8_t* in, size_t num_triplets,
+                                   char* out, const char* base64_chars) {
+  for (size_t i = 0; i < num_triplets; i++) {
+    out[0] = base64_chars[in[0] >> 2];
+    out[1] = base64_chars[((in[0] & 0x03) << 4) | (in[1] >> 4)];
+    out[2] = base64_chars[((in[1] & 0x0F) << 2) | (in[2] >> 6)];
+    out[3] = base64_chars[in[2] & 0x3F];
+    in += 3;
+    out += 4;
+  }
+}
+
+/* Returns the 6 bit value of c, or -1 if c is not in the alphabet (padding
+   included). */
+static int decode_char(uint8_t c, int url_safe) {
+  if (url_safe) {
+    if (c == '+' || c == '/') return -1;
+    if (c == '-') return 0x3E;
+    if (c == '_') return 0x3F;
+  }
+  if (c >= GPR_ARRAY_SIZE(base64_bytes)) return -1;
+  const int code = base64_bytes[c];
+  return code == GRPC_BASE64_PAD_BYTE ? -1 : code;
+}
+
+static size_t decode_quads_scalar(const uint8_t* in, size_t num_quads,
+                                  uint8_t* out, int url_safe) {
+  size_t done;
+  for (done = 0; done < num_quads; done++) {
+    uint32_t packed = 0;
+    for (size_t i = 0; i < 4; i++) {
+      const int code = decode_char(in[i], url_safe);
+      if (code < 0) return done;
+      packed = (packed << 6) | static_cast<uint32_t>(code);
+    }
+    out[0] = static_cast<uint8_t>(packed >> 16);
+    out[1] = static_cast<uint8_t>(packed >> 8);
+    out[2] = static_cast<uint8_t>(packed);
+    in += 4;
+    out += 3;
+  }
+  return done;
+}
+
+#ifdef GRPC_BASE64_X86_KERNELS
+
+/* Encoding (after http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html)
+   shuffles the input so that each 32 bit lane holds one triplet, splits it
+   into four 6 bit values with multiplies, and turns those into chars by adding
+   a per-range offset looked up with pshufb. Decoding classifies each char with
+   range compares, bails out of any block containing something outside the
+   alphabet, and packs the 6 bit values back together with multiply-adds. */
+
+__attribute__((target("ssse3"))) static __m128i encode_shift_lut_ssse3(
+    int url_safe) {
+  return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, url_safe ? '-' - 62 : '+' - 62,
+                       url_safe ? '_' - 63 : '/' - 63, 'A', 0, 0);
+}
+
+__attribute__((target("ssse3"))) static size_t encode_triplets_ssse3(
+    const uint8_t* in, size_t num_triplets, char* out, int url_safe) {
+  const __m128i shuffle =
+      _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const __m128i shift_lut = encode_shift_lut_ssse3(url_safe);
+  size_t done = 0;
+  /* each step loads 16 bytes and encodes the first 12 */
+  while (num_triplets - done >= 6) {
+    __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 3 * done));
+    v = _mm_shuffle_epi8(v, shuffle);
+    const __m128i hi = _mm_mulhi_epu16(
+        _mm_and_si128(v, _mm_set1_epi32(0x0fc0fc00)),
+        _mm_set1_epi32(0x04000040));
+    const __m128i lo = _mm_mullo_epi16(
+        _mm_and_si128(v, _mm_set1_epi32(0x003f03f0)),
+        _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(hi, lo);
+    __m128i shift = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    shift = _mm_or_si128(shift, _mm_and_si128(less, _mm_set1_epi8(13)));
+    shift = _mm_shuffle_epi8(shift_lut, shift);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * done),
+                     _mm_add_epi8(indices, shift));
+    done += 4;
+  }
+  return done;
+}
+
+__attribute__((target("avx2"))) static size_t encode_triplets_avx2(
+    const uint8_t* in, size_t num_triplets, char* out, int url_safe) {
+  const __m256i shuffle = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+  const __m256i shift_lut =
+      _mm256_broadcastsi128_si256(encode_shift_lut_ssse3(url_safe));
+  size_t done = 0;
+  /* each step loads 16 bytes at offsets 0 and 12, and encodes 24 */
+  while (num_triplets - done >= 10) {
+    const uint8_t* block = in + 3 * done;
+    __m256i v = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(block))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 12)), 1);
+    v = _mm256_shuffle_epi8(v, shuffle);
+    const __m256i hi = _mm256_mulhi_epu16(
+        _mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00)),
+        _mm256_set1_epi32(0x04000040));
+    const __m256i lo = _mm256_mullo_epi16(
+        _mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0)),
+        _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(hi, lo);
+    __m256i shift = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    shift =
+        _mm256_or_si256(shift, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+    shift = _mm256_shuffle_epi8(shift_lut, shift);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4 * done),
+                        _mm256_add_epi8(indices, shift));
+    done += 8;
+  }
+  return done + encode_triplets_ssse3(in + 3 * done, num_triplets - done,
+                                      out + 4 * done, url_safe);
+}
+
+/* Returns 0xff in each byte of v that lies in [lo, hi]. Bytes >= 0x80 compare
+   as negative and so are never in range. */
+__attribute__((target("ssse3"))) static __m128i in_range_ssse3(__m128i v,
+                                                               char lo,
+                                                               char hi) {
+  return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+                       _mm_cmpgt_epi8(_mm_set1_epi8(hi + 1), v));
+}
+
+__attribute__((target("ssse3"))) static size_t decode_quads_ssse3(
+    const uint8_t* in, size_t num_quads, uint8_t* out, int url_safe) {
+  const char c62 = url_safe ? '-' : '+';
+  const char c63 = url_safe ? '_' : '/';
+  const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                     -1, -1, -1, -1);
+  size_t done = 0;
+  /* each step decodes 16 chars into 12 bytes */
+  while (num_quads - done >= 4) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 4 * done));
+    const __m128i upper = in_range_ssse3(v, 'A', 'Z');
+    const __m128i lower = in_range_ssse3(v, 'a', 'z');
+    const __m128i digit = in_range_ssse3(v, '0', '9');
+    const __m128i is62 = _mm_cmpeq_epi8(v, _mm_set1_epi8(c62));
+    const __m128i is63 = _mm_cmpeq_epi8(v, _mm_set1_epi8(c63));
+    const __m128i valid = _mm_or_si128(
+        _mm_or_si128(upper, lower),
+        _mm_or_si128(digit, _mm_or_si128(is62, is63)));
+    if (_mm_movemask_epi8(valid) != 0xffff) break;
+    __m128i shift = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+    shift = _mm_or_si128(shift,
+                         _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+    shift = _mm_or_si128(shift,
+                         _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+    shift = _mm_or_si128(shift, _mm_and_si128(is62, _mm_set1_epi8(62 - c62)));
+    shift = _mm_or_si128(shift, _mm_and_si128(is63, _mm_set1_epi8(63 - c63)));
+    const __m128i values = _mm_add_epi8(v, shift);
+    /* merge pairs of 6 bit values, then pairs of 12 bit values */
+    __m128i packed =
+        _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    packed = _mm_madd_epi16(packed, _mm_set1_epi32(0x00011000));
+    packed = _mm_shuffle_epi8(packed, pack);
+    uint8_t* block = out + 3 * done;
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(block), packed);
+    const uint32_t tail =
+        static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(packed, 8)));
+    memcpy(block + 8, &tail, sizeof(tail));
+    done += 4;
+  }
+  return done;
+}
+
+__attribute__((target("avx2"))) static __m256i in_range_avx2(__m256i v,
+                                                             char lo,
+                                                             char hi) {
+  return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(lo - 1)),
+                          _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), v));
+}
+
+__attribute__((target("avx2"))) static size_t decode_quads_avx2(
+    const uint8_t* in, size_t num_quads, uint8_t* out, int url_safe) {
+  const char c62 = url_safe ? '-' : '+';
+  const char c63 = url_safe ? '_' : '/';
+  const __m256i pack = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  size_t done = 0;
+  /* each step decodes 32 chars into 24 bytes, 12 from each 128 bit lane */
+  while (num_quads - done >= 8) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 4 * done));
+    const __m256i upper = in_range_avx2(v, 'A', 'Z');
+    const __m256i lower = in_range_avx2(v, 'a', 'z');
+    const __m256i digit = in_range_avx2(v, '0', '9');
+    const __m256i is62 = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c62));
+    const __m256i is63 = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c63));
+    const __m256i valid = _mm256_or_si256(
+        _mm256_or_si256(upper, lower),
+        _mm256_or_si256(digit, _mm256_or_si256(is62, is63)));
+    if (_mm256_movemask_epi8(valid) != -1) break;
+    __m256i shift = _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+    shift = _mm256_or_si256(
+        shift, _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+    shift = _mm256_or_si256(
+        shift, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+    shift = _mm256_or_si256(
+        shift, _mm256_and_si256(is62, _mm256_set1_epi8(62 - c62)));
+    shift = _mm256_or_si256(
+        shift, _mm256_and_si256(is63, _mm256_set1_epi8(63 - c63)));
+    const __m256i values = _mm256_add_epi8(v, shift);
+    __m256i packed =
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    packed = _mm256_madd_epi16(packed, _mm256_set1_epi32(0x00011000));
+    packed = _mm256_shuffle_epi8(packed, pack);
+    uint8_t* block = out + 3 * done;
+    const __m128i lanes[2] = {_mm256_castsi256_si128(packed),
+                              _mm256_extracti128_si256(packed, 1)};
+    for (const __m128i& lane : lanes) {
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(block), lane);
+      const uint32_t tail =
+          static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(lane, 8)));
+      memcpy(block + 8, &tail, sizeof(tail));
+      block += 12;
+    }
+    done += 8;
+  }
+  return done + decode_quads_ssse3(in + 4 * done, num_quads - done,
+                                   out + 3 * done, url_safe);
+}
+
+#endif /* GRPC_BASE64_X86_KERNELS */
+
+typedef size_t (*encode_triplets_func)(const uint8_t* in, size_t num_triplets,
+                                       char* out, int url_safe);
+typedef size_t (*decode_quads_func)(const uint8_t* in, size_t num_quads,
+                                    uint8_t* out, int url_safe);
+
+struct base64_kernels {
+  encode_triplets_func encode;
+  decode_quads_func decode;
+};
+
+static base64_kernels select_kernels() {
+#ifdef GRPC_BASE64_X86_KERNELS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return {encode_triplets_avx2, decode_quads_avx2};
+  }
+  if (__builtin_cpu_supports("ssse3")) {
+    return {encode_triplets_ssse3, decode_quads_ssse3};
+  }
+#endif
+  return {nullptr, decode_quads_scalar};
+}
+
+static const base64_kernels& kernels() {
+  static const base64_kernels kernels = select_kernels();
+  return kernels;
+}
+
+void grpc_base64_encode_triplets(const uint8_t* in, size_t num_triplets,
+                                 char* out, int url_safe) {
+  const encode_triplets_func encode = kernels().encode;
+  const size_t done =
+      encode == nullptr ? 0 : encode(in, num_triplets, out, url_safe);
+  encode_triplets_scalar(
+      in + 3 * done, num_triplets - done, out + 4 * done,
+      url_safe ? base64_url_safe_chars : base64_url_unsafe_chars);
+}
+
+size_t grpc_base64_decode_quads(const uint8_t* in, size_t num_quads,
+                                uint8_t* out, int url_safe) {
+  const size_t done = kernels().decode(in, num_quads, out, url_safe);
+  /* the vector kernels stop at the first block with anything unusual in it;
+     decode whatever leading groups of that block are still plain */
+  return done + decode_quads_scalar(in + 4 * done, num_quads - done,
+                                    out + 3 * done, url_safe);
+}
+
 /* --- base64 functions. --- */
 
 char* grpc_base64_encode(const void* vdata, size_t data_size, int url_safe,
@@ -83,24 +375,20 @@ void grpc_base64_encode_core(char* result, const void* vdata, size_t data_size,
       grpc_base64_estimate_encoded_size(data_size, multiline);
 
   char* current = result;
-  size_t num_blocks = 0;
   size_t i = 0;
 
-  /* Encode each block. */
+  /* Encode each block, a line at a time. */
+  const size_t blocks_per_line =
+      multiline ? GRPC_BASE64_MULTILINE_NUM_BLOCKS : data_size / 3;
   while (data_size >= 3) {
-    *current++ = base64_chars[(data[i] >> 2) & 0x3F];
-    *current++ =
-        base64_chars[((data[i] & 0x03) << 4) | ((data[i + 1] >> 4) & 0x0F)];
-    *current++ =
-        base64_chars[((data[i + 1] & 0x0F) << 2) | ((data[i + 2] >> 6) & 0x03)];
-    *current++ = base64_chars[data[i + 2] & 0x3F];
-
-    data_size -= 3;
-    i += 3;
-    if (multiline && (++num_blocks == GRPC_BASE64_MULTILINE_NUM_BLOCKS)) {
+    const size_t num_blocks = GPR_MIN(data_size / 3, blocks_per_line);
+    grpc_base64_encode_triplets(data + i, num_blocks, current, url_safe);
+    current += 4 * num_blocks;
+    data_size -= 3 * num_blocks;
+    i += 3 * num_blocks;
+    if (multiline && num_blocks == GRPC_BASE64_MULTILINE_NUM_BLOCKS) {
       *current++ = '\r';
       *current++ = '\n';
-      num_blocks = 0;
     }
   }
 
@@ -196,7 +484,19 @@ grpc_slice grpc_base64_decode_with_len(const char* b64, size_t b64_len,
   unsigned char codes[4];
   size_t num_codes = 0;
 
-  while (b64_len--) {
+  while (b64_len > 0) {
+    if (num_codes == 0) {
+      /* decode the plain run ahead in bulk, up to the next padding, line
+         break or bad char */
+      const size_t num_quads = grpc_base64_decode_quads(
+          reinterpret_cast<const uint8_t*>(b64), b64_len / 4,
+          current + result_size, url_safe);
+      b64 += 4 * num_quads;
+      b64_len -= 4 * num_quads;
+      result_size += 3 * num_quads;
+      if (b64_len == 0) break;
+    }
+    b64_len--;
     unsigned char c = static_cast<unsigned char>(*b64++);
     signed char code;
     if (c >= GPR_ARRAY_SIZE(base64_bytes)) continue;
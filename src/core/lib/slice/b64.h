@@ -39,6 +39,19 @@ size_t grpc_base64_estimate_encoded_size(size_t data_size, int multiline);
 void grpc_base64_encode_core(char* result, const void* vdata, size_t data_size,
                              int url_safe, int multiline);
 
+/* Encodes the first 3 * num_triplets bytes of in into exactly 4 * num_triplets
+   chars at out, with no padding, line breaks or terminator. Uses SSSE3/AVX2
+   when the CPU has them. */
+void grpc_base64_encode_triplets(const uint8_t* in, size_t num_triplets,
+                                 char* out, int url_safe);
+
+/* Decodes up to num_quads groups of 4 chars from in into out, which must have
+   room for 3 * num_quads bytes. Stops at the first group that is not four
+   alphabet chars (padding and line breaks included), and returns the number
+   of groups decoded; the caller handles whatever follows. */
+size_t grpc_base64_decode_quads(const uint8_t* in, size_t num_quads,
+                                uint8_t* out, int url_safe);
+
 /* Decodes data according to the base64 specification. Returns an empty
    slice in case of failure. */
 grpc_slice grpc_base64_decode(const char* b64, int url_safe);
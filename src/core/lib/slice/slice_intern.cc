@@ -24,7 +24,10 @@
 #include <inttypes.h>
 #include <string.h>
 
+#include <atomic>
+
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gpr/murmur_hash.h"
@@ -36,22 +39,70 @@
 
 #define LOG2_SHARD_COUNT 5
 #define SHARD_COUNT (1 << LOG2_SHARD_COUNT)
-#define INITIAL_SHARD_CAPACITY 8
+#define INITIAL_SHARD_CAPACITY 16
+#define READER_STRIPE_COUNT 64
+// Number of slices a shard retires before it tries to end a grace period.
+#define RETIRE_BATCH_SIZE 16
 
-#define TABLE_IDX(hash, capacity) (((hash) >> LOG2_SHARD_COUNT) % (capacity))
+#define TABLE_IDX(hash, capacity) \
+  (((hash) >> LOG2_SHARD_COUNT) & ((capacity)-1))
 #define SHARD_IDX(hash) ((hash) & ((1 << LOG2_SHARD_COUNT) - 1))
 
 using grpc_core::InternedSliceRefcount;
 
+// Each shard is an open-addressing (linear probing) table of interned slices.
+// Lookups do not take the shard lock: they walk the current table while
+// inside a read section (see below).  Insertions, removals and rebuilds are
+// serialized by the shard lock; a rebuild publishes a new table and retires
+// the old one, so readers always see a complete table.
+//
+// Removed slots are marked with TOMBSTONE so that probe sequences through
+// them stay intact; they are dropped on the next rebuild.
+#define TOMBSTONE (reinterpret_cast<InternedSliceRefcount*>(1))
+
+typedef struct intern_table {
+  size_t capacity;  // always a power of two
+  std::atomic<InternedSliceRefcount*>* slots;
+  // Retired list link and epoch, as for InternedSliceRefcount.
+  struct intern_table* retired_next;
+  uint64_t retired_epoch;
+} intern_table;
+
 typedef struct slice_shard {
   grpc_core::Mutex mu;
-  InternedSliceRefcount** strs;
-  size_t count;
-  size_t capacity;
+  std::atomic<intern_table*> table;
+  // The following fields are guarded by mu.
+  size_t count;  // live entries
+  size_t used;   // live entries + tombstones
+  // Slices and tables removed from this shard that may still be visible
+  // to readers, in retirement order.
+  InternedSliceRefcount* retired_head;
+  InternedSliceRefcount* retired_tail;
+  size_t retired_count;
+  intern_table* retired_tables;
 } slice_shard;
 
 static slice_shard* g_shards;
 
+// Memory removed from the tables is reclaimed using epochs.  A lookup
+// registers itself in one of two per-stripe reader counters, selected by the
+// parity of g_epoch, and checks that the epoch did not change while it did
+// so.  Memory retired during epoch E may be freed once g_completed_epoch
+// exceeds E, i.e. once every reader that registered under an epoch <= E has
+// left.  A grace period is ended, and the next one started, by whichever
+// shard gets to g_grace_period_mu first; nobody ever waits for readers.
+typedef struct reader_stripe {
+  union {
+    char pad[GPR_CACHELINE_SIZE];
+    std::atomic<intptr_t> active[2];
+  };
+} reader_stripe;
+
+static reader_stripe g_reader_stripes[READER_STRIPE_COUNT];
+static std::atomic<uint64_t> g_epoch{1};
+static std::atomic<uint64_t> g_completed_epoch{1};
+static grpc_core::Mutex* g_grace_period_mu;
+
 struct static_metadata_hash_ent {
   uint32_t hash;
   uint32_t idx;
@@ -61,51 +112,170 @@ static static_metadata_hash_ent
 static uint32_t max_static_metadata_hash_probe;
 uint32_t grpc_static_metadata_hash_values[GRPC_STATIC_MDSTR_COUNT];
 
-namespace grpc_core {
+namespace {
+
+// Marks a lock-free lookup in the intern tables.  Anything read from a table
+// inside the section stays allocated until the section ends.
+class ReadSection {
+ public:
+  ReadSection()
+      : stripe_(&g_reader_stripes[gpr_cpu_current_cpu() %
+                                  READER_STRIPE_COUNT]) {
+    while (true) {
+      const uint64_t epoch = g_epoch.load();
+      parity_ = epoch & 1;
+      stripe_->active[parity_].fetch_add(1);
+      if (g_epoch.load() == epoch) break;
+      stripe_->active[parity_].fetch_sub(1);
+    }
+  }
 
-/* hash seed: decided at initialization time */
-uint32_t g_hash_seed;
-static bool g_forced_hash_seed = false;
+  ~ReadSection() { stripe_->active[parity_].fetch_sub(1); }
 
-InternedSliceRefcount::~InternedSliceRefcount() {
-  slice_shard* shard = &g_shards[SHARD_IDX(this->hash)];
-  MutexLock lock(&shard->mu);
-  InternedSliceRefcount** prev_next;
-  InternedSliceRefcount* cur;
-  for (prev_next = &shard->strs[TABLE_IDX(this->hash, shard->capacity)],
-      cur = *prev_next;
-       cur != this; prev_next = &cur->bucket_next, cur = cur->bucket_next) {
+  ReadSection(const ReadSection&) = delete;
+  ReadSection& operator=(const ReadSection&) = delete;
+
+ private:
+  reader_stripe* stripe_;
+  size_t parity_;
+};
+
+}  // namespace
+
+static intern_table* intern_table_create(size_t capacity) {
+  intern_table* table = new intern_table;
+  table->capacity = capacity;
+  table->slots = new std::atomic<InternedSliceRefcount*>[capacity]();
+  table->retired_next = nullptr;
+  table->retired_epoch = 0;
+  return table;
+}
+
+static void intern_table_destroy(intern_table* table) {
+  delete[] table->slots;
+  delete table;
+}
+
+static void free_interned_slice(InternedSliceRefcount* s) {
+  s->~InternedSliceRefcount();
+  gpr_free(s);
+}
+
+// Ends the current grace period if all readers of the previous epoch have
+// left, and starts a new one.  Never blocks: if another thread is already
+// doing this, or readers are still active, we try again later.
+static void maybe_advance_grace_period() {
+  if (!g_grace_period_mu->TryLock()) return;
+  const uint64_t epoch = g_epoch.load();
+  if (g_completed_epoch.load(std::memory_order_relaxed) != epoch) {
+    const size_t prev_parity = (epoch - 1) & 1;
+    intptr_t active = 0;
+    for (size_t i = 0; i < READER_STRIPE_COUNT; i++) {
+      active += g_reader_stripes[i].active[prev_parity].load();
+    }
+    if (active != 0) {
+      g_grace_period_mu->Unlock();
+      return;
+    }
+    g_completed_epoch.store(epoch, std::memory_order_release);
   }
-  *prev_next = cur->bucket_next;
-  shard->count--;
+  g_epoch.fetch_add(1);
+  g_grace_period_mu->Unlock();
 }
 
-}  // namespace grpc_core
+// Frees whatever the shard retired that no reader can still see.
+static void reclaim_retired_locked(slice_shard* shard) {
+  const uint64_t completed = g_completed_epoch.load(std::memory_order_acquire);
+  while (shard->retired_head != nullptr &&
+         shard->retired_head->retired_epoch < completed) {
+    InternedSliceRefcount* s = shard->retired_head;
+    shard->retired_head = s->retired_next;
+    shard->retired_count--;
+    free_interned_slice(s);
+  }
+  if (shard->retired_head == nullptr) shard->retired_tail = nullptr;
+  intern_table** prev_next = &shard->retired_tables;
+  while (*prev_next != nullptr) {
+    intern_table* table = *prev_next;
+    if (table->retired_epoch < completed) {
+      *prev_next = table->retired_next;
+      intern_table_destroy(table);
+    } else {
+      prev_next = &table->retired_next;
+    }
+  }
+}
 
-static void grow_shard(slice_shard* shard) {
+// Inserts s into table, which must have a free slot.  Only used on tables
+// that readers cannot see yet, or under the shard lock.
+static void intern_table_insert(intern_table* table, InternedSliceRefcount* s) {
+  const size_t mask = table->capacity - 1;
+  for (size_t i = TABLE_IDX(s->hash, table->capacity);; i = (i + 1) & mask) {
+    InternedSliceRefcount* cur =
+        table->slots[i].load(std::memory_order_relaxed);
+    if (cur == nullptr || cur == TOMBSTONE) {
+      table->slots[i].store(s);
+      return;
+    }
+  }
+}
+
+// Replaces the shard's table by one sized for its live entries, dropping
+// tombstones.  The old table is retired, since readers may still be probing
+// it.
+static void rebuild_shard_locked(slice_shard* shard) {
   GPR_TIMER_SCOPE("grow_strtab", 0);
+  intern_table* old_table = shard->table.load(std::memory_order_relaxed);
+  size_t capacity = INITIAL_SHARD_CAPACITY;
+  while (capacity < shard->count * 4) capacity *= 2;
+  intern_table* table = intern_table_create(capacity);
+  for (size_t i = 0; i < old_table->capacity; i++) {
+    InternedSliceRefcount* s =
+        old_table->slots[i].load(std::memory_order_relaxed);
+    if (s != nullptr && s != TOMBSTONE) intern_table_insert(table, s);
+  }
+  shard->table.store(table);
+  shard->used = shard->count;
+  old_table->retired_epoch = g_epoch.load();
+  old_table->retired_next = shard->retired_tables;
+  shard->retired_tables = old_table;
+}
 
-  size_t capacity = shard->capacity * 2;
-  size_t i;
-  InternedSliceRefcount** strtab;
-  InternedSliceRefcount *s, *next;
+namespace grpc_core {
 
-  strtab = static_cast<InternedSliceRefcount**>(
-      gpr_zalloc(sizeof(InternedSliceRefcount*) * capacity));
+/* hash seed: decided at initialization time */
+uint32_t g_hash_seed;
+static bool g_forced_hash_seed = false;
 
-  for (i = 0; i < shard->capacity; i++) {
-    for (s = shard->strs[i]; s; s = next) {
-      size_t idx = TABLE_IDX(s->hash, capacity);
-      next = s->bucket_next;
-      s->bucket_next = strtab[idx];
-      strtab[idx] = s;
+void InternedSliceRefcount::Destroy(void* arg) {
+  InternedSliceRefcount* s = static_cast<InternedSliceRefcount*>(arg);
+  slice_shard* shard = &g_shards[SHARD_IDX(s->hash)];
+  MutexLock lock(&shard->mu);
+  intern_table* table = shard->table.load(std::memory_order_relaxed);
+  const size_t mask = table->capacity - 1;
+  for (size_t i = TABLE_IDX(s->hash, table->capacity);; i = (i + 1) & mask) {
+    if (table->slots[i].load(std::memory_order_relaxed) == s) {
+      table->slots[i].store(TOMBSTONE);
+      break;
     }
   }
-  gpr_free(shard->strs);
-  shard->strs = strtab;
-  shard->capacity = capacity;
+  shard->count--;
+  // Readers that started before the store above may still be looking at s.
+  s->retired_epoch = g_epoch.load();
+  if (shard->retired_tail == nullptr) {
+    shard->retired_head = s;
+  } else {
+    shard->retired_tail->retired_next = s;
+  }
+  shard->retired_tail = s;
+  if (++shard->retired_count >= RETIRE_BATCH_SIZE) {
+    maybe_advance_grace_period();
+  }
+  reclaim_retired_locked(shard);
 }
 
+}  // namespace grpc_core
+
 grpc_core::InternedSlice::InternedSlice(InternedSliceRefcount* s) {
   refcount = &s->base;
   data.refcounted.bytes = reinterpret_cast<uint8_t*>(s + 1);
@@ -202,7 +372,6 @@ static size_t GetLength(const grpc_slice& slice) {
 // Returns: a newly interned slice.
 template <typename SliceArgs>
 static InternedSliceRefcount* InternNewStringLocked(slice_shard* shard,
-                                                    size_t shard_idx,
                                                     uint32_t hash,
                                                     const SliceArgs& args) {
   /* string data goes after the internal_string header */
@@ -210,60 +379,72 @@ static InternedSliceRefcount* InternNewStringLocked(slice_shard* shard,
   const void* buffer = GetBuffer(args);
   InternedSliceRefcount* s =
       static_cast<InternedSliceRefcount*>(gpr_malloc(sizeof(*s) + len));
-  new (s) grpc_core::InternedSliceRefcount(len, hash, shard->strs[shard_idx]);
+  new (s) grpc_core::InternedSliceRefcount(len, hash);
   // TODO(arjunroy): Investigate why hpack tried to intern the nullptr string.
   // https://github.com/grpc/grpc/pull/20110#issuecomment-526729282
   if (len > 0) {
     memcpy(reinterpret_cast<char*>(s + 1), buffer, len);
   }
-  shard->strs[shard_idx] = s;
-  shard->count++;
-  if (shard->count > shard->capacity * 2) {
-    grow_shard(shard);
+  // Keep at least half of the slots empty, so probe sequences stay short.
+  if ((shard->used + 1) * 2 >
+      shard->table.load(std::memory_order_relaxed)->capacity) {
+    rebuild_shard_locked(shard);
   }
+  // Publishing s into a slot is what makes it visible to readers, so this
+  // must come after its contents are written.
+  intern_table_insert(shard->table.load(std::memory_order_relaxed), s);
+  shard->count++;
+  shard->used++;
   return s;
 }
 
 // Attempt to see if the provided slice or string matches an existing interned
 // slice. SliceArgs... is either a const grpc_slice& or a string and length. In
-// either case, hash is the pre-computed hash value.  We must already hold the
-// shard lock. Helper for FindOrCreateInternedSlice().
+// either case, hash is the pre-computed hash value.  Must be called either
+// inside a ReadSection or with the shard lock held. Helper for
+// FindOrCreateInternedSlice().
 //
-// Returns: a pre-existing matching static slice, or null.
+// Returns: a pre-existing matching interned slice, or null.
 template <typename SliceArgs>
-static InternedSliceRefcount* MatchInternedSliceLocked(uint32_t hash,
-                                                       size_t idx,
-                                                       const SliceArgs& args) {
-  InternedSliceRefcount* s;
-  slice_shard* shard = &g_shards[SHARD_IDX(hash)];
+static InternedSliceRefcount* MatchInternedSlice(const intern_table* table,
+                                                 uint32_t hash,
+                                                 const SliceArgs& args) {
+  const size_t mask = table->capacity - 1;
   /* search for an existing string */
-  for (s = shard->strs[idx]; s; s = s->bucket_next) {
-    if (s->hash == hash && grpc_core::InternedSlice(s) == args) {
-      if (s->refcnt.RefIfNonZero()) {
-        return s;
-      }
+  for (size_t i = TABLE_IDX(hash, table->capacity);; i = (i + 1) & mask) {
+    InternedSliceRefcount* s = table->slots[i].load();
+    if (s == nullptr) return nullptr;
+    if (s != TOMBSTONE && s->hash == hash &&
+        grpc_core::InternedSlice(s) == args && s->refcnt.RefIfNonZero()) {
+      return s;
     }
   }
-  return nullptr;
 }
 
 // Attempt to see if the provided slice or string matches an existing interned
 // slice, and failing that, create an interned slice with its contents. Returns
 // either the existing matching interned slice or the newly created one.
 // SliceArgs is either a const grpc_slice& or const pair<const char*, size_t>&.
-// In either case, hash is the pre-computed hash value. We do not hold the
-// shard lock here, but do take it.
+// In either case, hash is the pre-computed hash value. The lookup is done
+// without the shard lock; the lock is only taken to insert a new slice.
 //
 // Returns: an interned slice, either pre-existing/matched or newly created.
 template <typename SliceArgs>
 static InternedSliceRefcount* FindOrCreateInternedSlice(uint32_t hash,
                                                         const SliceArgs& args) {
   slice_shard* shard = &g_shards[SHARD_IDX(hash)];
+  {
+    ReadSection read_section;
+    InternedSliceRefcount* s =
+        MatchInternedSlice(shard->table.load(), hash, args);
+    if (s != nullptr) return s;
+  }
   grpc_core::MutexLock lock(&shard->mu);
-  const size_t idx = TABLE_IDX(hash, shard->capacity);
-  InternedSliceRefcount* s = MatchInternedSliceLocked(hash, idx, args);
+  // Somebody may have inserted the string since we looked.
+  InternedSliceRefcount* s = MatchInternedSlice(
+      shard->table.load(std::memory_order_relaxed), hash, args);
   if (s == nullptr) {
-    s = InternNewStringLocked(shard, idx, hash, args);
+    s = InternNewStringLocked(shard, hash, args);
   }
   return s;
 }
@@ -314,11 +495,16 @@ void grpc_slice_intern_init(void) {
   g_shards = new slice_shard[SHARD_COUNT];
   for (size_t i = 0; i < SHARD_COUNT; i++) {
     slice_shard* shard = &g_shards[i];
+    shard->table.store(intern_table_create(INITIAL_SHARD_CAPACITY),
+                       std::memory_order_relaxed);
     shard->count = 0;
-    shard->capacity = INITIAL_SHARD_CAPACITY;
-    shard->strs = static_cast<InternedSliceRefcount**>(
-        gpr_zalloc(sizeof(*shard->strs) * shard->capacity));
+    shard->used = 0;
+    shard->retired_head = nullptr;
+    shard->retired_tail = nullptr;
+    shard->retired_count = 0;
+    shard->retired_tables = nullptr;
   }
+  g_grace_period_mu = new grpc_core::Mutex();
   for (size_t i = 0; i < GPR_ARRAY_SIZE(static_metadata_hash); i++) {
     static_metadata_hash[i].hash = 0;
     static_metadata_hash[i].idx = GRPC_STATIC_MDSTR_COUNT;
@@ -355,19 +541,33 @@ void grpc_slice_intern_shutdown(void) {
     if (shard->count != 0) {
       gpr_log(GPR_DEBUG, "WARNING: %" PRIuPTR " metadata strings were leaked",
               shard->count);
-      for (size_t j = 0; j < shard->capacity; j++) {
-        for (InternedSliceRefcount* s = shard->strs[j]; s; s = s->bucket_next) {
-          char* text = grpc_dump_slice(grpc_core::InternedSlice(s),
-                                       GPR_DUMP_HEX | GPR_DUMP_ASCII);
-          gpr_log(GPR_DEBUG, "LEAKED: %s", text);
-          gpr_free(text);
-        }
+      intern_table* table = shard->table.load(std::memory_order_relaxed);
+      for (size_t j = 0; j < table->capacity; j++) {
+        InternedSliceRefcount* s =
+            table->slots[j].load(std::memory_order_relaxed);
+        if (s == nullptr || s == TOMBSTONE) continue;
+        char* text = grpc_dump_slice(grpc_core::InternedSlice(s),
+                                     GPR_DUMP_HEX | GPR_DUMP_ASCII);
+        gpr_log(GPR_DEBUG, "LEAKED: %s", text);
+        gpr_free(text);
       }
       if (grpc_iomgr_abort_on_leaks()) {
         abort();
       }
     }
-    gpr_free(shard->strs);
+    // No lookups can be running any more, so everything retired can go.
+    while (shard->retired_head != nullptr) {
+      InternedSliceRefcount* s = shard->retired_head;
+      shard->retired_head = s->retired_next;
+      free_interned_slice(s);
+    }
+    while (shard->retired_tables != nullptr) {
+      intern_table* table = shard->retired_tables;
+      shard->retired_tables = table->retired_next;
+      intern_table_destroy(table);
+    }
+    intern_table_destroy(shard->table.load(std::memory_order_relaxed));
   }
   delete[] g_shards;
+  delete g_grace_period_mu;
 }
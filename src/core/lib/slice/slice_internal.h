@@ -187,28 +187,25 @@ struct StaticSliceRefcount {
 extern grpc_slice_refcount kNoopRefcount;
 
 struct InternedSliceRefcount {
-  static void Destroy(void* arg) {
-    auto* rc = static_cast<InternedSliceRefcount*>(arg);
-    rc->~InternedSliceRefcount();
-    gpr_free(rc);
-  }
+  // Removes the slice from the intern table.  The memory is released once
+  // no concurrent lock-free lookup can still be examining it.
+  static void Destroy(void* arg);
 
-  InternedSliceRefcount(size_t length, uint32_t hash,
-                        InternedSliceRefcount* bucket_next)
+  InternedSliceRefcount(size_t length, uint32_t hash)
       : base(grpc_slice_refcount::Type::INTERNED, &refcnt, Destroy, this, &sub),
         sub(grpc_slice_refcount::Type::REGULAR, &refcnt, Destroy, this, &sub),
         length(length),
-        hash(hash),
-        bucket_next(bucket_next) {}
-
-  ~InternedSliceRefcount();
+        hash(hash) {}
 
   grpc_slice_refcount base;
   grpc_slice_refcount sub;
   const size_t length;
   RefCount refcnt;
   const uint32_t hash;
-  InternedSliceRefcount* bucket_next;
+  // Link and epoch for the intern table's list of removed slices awaiting
+  // reclamation.
+  InternedSliceRefcount* retired_next = nullptr;
+  uint64_t retired_epoch = 0;
 };
 
 }  // namespace grpc_core
@@ -355,7 +355,8 @@ grpc_error* grpc_call_create(const grpc_call_create_args* args,
       call_and_stack_size + (args->parent ? sizeof(child_call) : 0);
 
   std::pair<grpc_core::Arena*, void*> arena_with_call =
-      grpc_core::Arena::CreateWithAlloc(initial_size, call_alloc_size);
+      grpc_channel_create_call_arena(args->channel, initial_size,
+                                     call_alloc_size);
   arena = arena_with_call.first;
   call = new (arena_with_call.second) grpc_call(arena, *args);
   *out_call = call;
@@ -529,7 +530,8 @@ static void release_call(void* call, grpc_error* /*error*/) {
   grpc_channel* channel = c->channel;
   grpc_core::Arena* arena = c->arena;
   c->~grpc_call();
-  grpc_channel_update_call_size_estimate(channel, arena->Destroy());
+  grpc_channel_update_call_size_estimate(
+      channel, grpc_channel_release_call_arena(channel, arena));
   GRPC_CHANNEL_INTERNAL_UNREF(channel, "call");
 }
 
@@ -37,7 +37,9 @@
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/iomgr/resource_quota.h"
@@ -54,6 +56,87 @@
  *  (OK, Cancelled, Unknown). */
 #define NUM_CACHED_STATUS_ELEMS 3
 
+#define DEFAULT_CALL_ARENA_POOL_SIZE 0
+
+namespace grpc_core {
+
+// The pool of call arenas of a channel. If the channel has a resource quota,
+// a benign reclaimer empties the pool when the quota is under pressure.
+// Refcounted, because a posted reclaimer can outlive the channel.
+class CallArenaPool : public RefCounted<CallArenaPool> {
+ public:
+  CallArenaPool(size_t max_cached_bytes, grpc_resource_quota* resource_quota)
+      : pool_(max_cached_bytes) {
+    if (resource_quota != nullptr) {
+      resource_user_ =
+          grpc_resource_user_create(resource_quota, "call_arena_pool");
+      GRPC_CLOSURE_INIT(&reclaimer_, Reclaim, this, grpc_schedule_on_exec_ctx);
+    }
+  }
+
+  ~CallArenaPool() override {
+    if (resource_user_ != nullptr) {
+      grpc_resource_user_unref(resource_user_);
+    }
+  }
+
+  std::pair<Arena*, void*> CreateWithAlloc(size_t initial_size,
+                                           size_t alloc_size) {
+    return pool_.CreateWithAlloc(initial_size, alloc_size);
+  }
+
+  size_t Release(Arena* arena) {
+    size_t size = pool_.Release(arena);
+    MaybePostReclaimer();
+    return size;
+  }
+
+  // Called when the channel is destroyed: cancels any posted reclaimer.
+  void Shutdown() {
+    pool_.Clear();
+    if (resource_user_ != nullptr) {
+      grpc_resource_user_shutdown(resource_user_);
+    }
+  }
+
+ private:
+  void MaybePostReclaimer() {
+    if (resource_user_ == nullptr ||
+        reclaimer_posted_.Load(MemoryOrder::ACQUIRE)) {
+      return;
+    }
+    bool expected = false;
+    if (reclaimer_posted_.CompareExchangeStrong(&expected, true,
+                                                MemoryOrder::ACQ_REL,
+                                                MemoryOrder::ACQUIRE)) {
+      Ref().release();  // Released in Reclaim().
+      grpc_resource_user_post_reclaimer(resource_user_, false, &reclaimer_);
+    }
+  }
+
+  static void Reclaim(void* arg, grpc_error* error) {
+    CallArenaPool* pool = static_cast<CallArenaPool*>(arg);
+    if (error == GRPC_ERROR_NONE) {
+      size_t freed = pool->pool_.Clear();
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
+        gpr_log(GPR_INFO, "call arena pool %p: freed %" PRIuPTR " bytes", pool,
+                freed);
+      }
+      // Arenas released from now on post a new reclaimer.
+      pool->reclaimer_posted_.Store(false, MemoryOrder::RELEASE);
+      grpc_resource_user_finish_reclamation(pool->resource_user_);
+    }
+    pool->Unref();
+  }
+
+  ArenaPool pool_;
+  grpc_resource_user* resource_user_ = nullptr;
+  grpc_closure reclaimer_;
+  Atomic<bool> reclaimer_posted_{false};
+};
+
+}  // namespace grpc_core
+
 static void destroy_channel(void* arg, grpc_error* error);
 
 grpc_channel* grpc_channel_create_with_builder(
@@ -97,6 +180,7 @@ grpc_channel* grpc_channel_create_with_builder(
           grpc_call_get_initial_size_estimate());
 
   grpc_compression_options_init(&channel->compression_options);
+  int call_arena_pool_size = DEFAULT_CALL_ARENA_POOL_SIZE;
   for (size_t i = 0; i < args->num_args; i++) {
     if (0 ==
         strcmp(args->args[i].key, GRPC_COMPRESSION_CHANNEL_DEFAULT_LEVEL)) {
@@ -129,6 +213,18 @@ grpc_channel* grpc_channel_create_with_builder(
         gpr_log(GPR_DEBUG,
                 GRPC_ARG_CHANNELZ_CHANNEL_NODE " should be a pointer");
       }
+    } else if (0 == strcmp(args->args[i].key, GRPC_ARG_CALL_ARENA_POOL_SIZE)) {
+      call_arena_pool_size = grpc_channel_arg_get_integer(
+          &args->args[i], {DEFAULT_CALL_ARENA_POOL_SIZE, 0, INT_MAX});
+    }
+  }
+  if (call_arena_pool_size > 0) {
+    grpc_resource_quota* resource_quota =
+        grpc_resource_quota_from_channel_args(args, false);
+    channel->call_arena_pool =
+        new grpc_core::CallArenaPool(call_arena_pool_size, resource_quota);
+    if (resource_quota != nullptr) {
+      grpc_resource_quota_unref_internal(resource_quota);
     }
   }
 
@@ -316,6 +412,22 @@ void grpc_channel_update_call_size_estimate(grpc_channel* channel,
   }
 }
 
+std::pair<grpc_core::Arena*, void*> grpc_channel_create_call_arena(
+    grpc_channel* channel, size_t initial_size, size_t alloc_size) {
+  if (channel->call_arena_pool == nullptr) {
+    return grpc_core::Arena::CreateWithAlloc(initial_size, alloc_size);
+  }
+  return channel->call_arena_pool->CreateWithAlloc(initial_size, alloc_size);
+}
+
+size_t grpc_channel_release_call_arena(grpc_channel* channel,
+                                       grpc_core::Arena* arena) {
+  if (channel->call_arena_pool == nullptr) {
+    return arena->Destroy();
+  }
+  return channel->call_arena_pool->Release(arena);
+}
+
 char* grpc_channel_get_target(grpc_channel* channel) {
   GRPC_API_TRACE("grpc_channel_get_target(channel=%p)", 1, (channel));
   return gpr_strdup(channel->target);
@@ -507,6 +619,10 @@ static void destroy_channel(void* arg, grpc_error* /*error*/) {
   }
   grpc_channel_stack_destroy(CHANNEL_STACK_FROM_CHANNEL(channel));
   channel->registration_table.Destroy();
+  if (channel->call_arena_pool != nullptr) {
+    channel->call_arena_pool->Shutdown();
+    channel->call_arena_pool->Unref();
+  }
   if (channel->resource_user != nullptr) {
     grpc_resource_user_free(channel->resource_user,
                             GRPC_RESOURCE_QUOTA_CHANNEL_SIZE);
@@ -22,10 +22,12 @@
 #include <grpc/support/port_platform.h>
 
 #include <map>
+#include <utility>
 
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/gprpp/arena.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/transport/metadata.h"
@@ -67,6 +69,16 @@ grpc_core::channelz::ChannelNode* grpc_channel_get_channelz_node(
 size_t grpc_channel_get_call_size_estimate(grpc_channel* channel);
 void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size);
 
+/** Create the arena of a call on \a channel, with \a initial_size bytes in
+    its initial zone, and return it along with a first allocation of
+    \a alloc_size bytes. Reuses the arena of a finished call if possible. */
+std::pair<grpc_core::Arena*, void*> grpc_channel_create_call_arena(
+    grpc_channel* channel, size_t initial_size, size_t alloc_size);
+/** Release the arena of a finished call on \a channel, returning the total
+    number of bytes that were allocated from it. */
+size_t grpc_channel_release_call_arena(grpc_channel* channel,
+                                       grpc_core::Arena* arena);
+
 namespace grpc_core {
 
 struct RegisteredCall {
@@ -89,6 +101,8 @@ struct RegisteredCall {
   ~RegisteredCall();
 };
 
+class CallArenaPool;
+
 struct CallRegistrationTable {
   grpc_core::Mutex mu;
   // The map key should be owned strings rather than unowned char*'s to
@@ -107,6 +121,8 @@ struct grpc_channel {
 
   gpr_atm call_size_estimate;
   grpc_resource_user* resource_user;
+  // Arenas of finished calls, kept for reuse. Null if disabled.
+  grpc_core::CallArenaPool* call_arena_pool;
 
   // TODO(vjpai): Once the grpc_channel is allocated via new rather than malloc,
   //              expand the members of the CallRegistrationTable directly into
@@ -51,6 +51,12 @@ grpc_core::TraceFlag grpc_trace_operation_failures(false, "op_failure");
 grpc_core::DebugOnlyTraceFlag grpc_trace_pending_tags(false, "pending_tags");
 grpc_core::DebugOnlyTraceFlag grpc_trace_cq_refcount(false, "cq_refcount");
 
+GPR_GLOBAL_CONFIG_DEFINE_BOOL(
+    grpc_cq_next_ring, false,
+    "If set, completion queues of type GRPC_CQ_NEXT created from then on "
+    "buffer events in a bounded lock-free ring that several threads can "
+    "dequeue from concurrently without taking the pollset lock.");
+
 namespace {
 
 // Specifies a cq thread local cache.
@@ -213,14 +219,62 @@ struct cq_vtable {
 
 namespace {
 
+/* Bounded lock-free multi-producer multi-consumer ring of completions, based
+ * upon the implementation from Dmitry Vyukov here:
+ * http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ * Every cell carries a sequence number telling producers and consumers whether
+ * it is ready for the lap they are on, so any number of threads can pop
+ * concurrently without a lock. */
+class CqEventRing {
+ public:
+  static constexpr size_t kSize = 1024;
+
+  CqEventRing() : enqueue_pos_(0), dequeue_pos_(0) {
+    for (size_t i = 0; i < kSize; i++) {
+      cells_[i].sequence.Store(i, grpc_core::MemoryOrder::RELAXED);
+    }
+  }
+
+  /* Returns false if the ring is full */
+  bool TryPush(grpc_cq_completion* c);
+  /* Returns NULL if the ring is empty or the next cell has been claimed by a
+   * producer that has not finished publishing it yet */
+  grpc_cq_completion* TryPop();
+
+ private:
+  static_assert((kSize & (kSize - 1)) == 0, "kSize must be a power of two");
+
+  struct Cell {
+    grpc_core::Atomic<size_t> sequence;
+    grpc_cq_completion* data;
+  };
+
+  // keep producers, consumers and the cells on separate cachelines
+  union {
+    char enqueue_padding_[GPR_CACHELINE_SIZE];
+    grpc_core::Atomic<size_t> enqueue_pos_;
+  };
+  union {
+    char dequeue_padding_[GPR_CACHELINE_SIZE];
+    grpc_core::Atomic<size_t> dequeue_pos_;
+  };
+  Cell cells_[kSize];
+};
+
 /* Queue that holds the cq_completion_events. Internally uses
  * MultiProducerSingleConsumerQueue (a lockfree multiproducer single consumer
  * queue). It uses a queue_lock to support multiple consumers.
+ * If constructed with use_ring, events go to a CqEventRing first and only
+ * spill into the MultiProducerSingleConsumerQueue once the ring is full, so
+ * concurrent consumers rarely touch the queue_lock. While any event is
+ * spilled, new events queue up behind it rather than in the ring, so the
+ * ring drains and spilled events cannot be starved by a steady producer.
  * Only used in completion queues whose completion_type is GRPC_CQ_NEXT */
 class CqEventQueue {
  public:
-  CqEventQueue() = default;
-  ~CqEventQueue() = default;
+  explicit CqEventQueue(bool use_ring)
+      : ring_(use_ring ? new CqEventRing() : nullptr) {}
+  ~CqEventQueue() { delete ring_; }
 
   /* Note: The counter is not incremented/decremented atomically with push/pop.
    * The count is only eventually consistent */
@@ -237,6 +291,15 @@ class CqEventQueue {
 
   grpc_core::MultiProducerSingleConsumerQueue queue_;
 
+  /* Number of events pushed to queue_ and not yet popped (only tracked if
+     ring_ is set). Incremented before the push, so it is never lower than the
+     actual number of spilled events. */
+  grpc_core::Atomic<intptr_t> num_spilled_{0};
+
+  /* Lock-free fast path for multiple consumers; NULL unless enabled through
+     GRPC_CQ_NEXT_RING */
+  CqEventRing* const ring_;
+
   /* A lazy counter of number of items in the queue. This is NOT atomically
      incremented/decremented along with push/pop operations and hence is only
      eventually consistent */
@@ -244,6 +307,7 @@ class CqEventQueue {
 };
 
 struct cq_next_data {
+  explicit cq_next_data(bool use_ring) : queue(use_ring) {}
   ~cq_next_data() {
     GPR_ASSERT(queue.num_items() == 0);
 #ifndef NDEBUG
@@ -481,26 +545,89 @@ int grpc_completion_queue_thread_local_cache_flush(grpc_completion_queue* cq,
   return ret;
 }
 
+bool CqEventRing::TryPush(grpc_cq_completion* c) {
+  size_t pos = enqueue_pos_.Load(grpc_core::MemoryOrder::RELAXED);
+  Cell* cell;
+  for (;;) {
+    cell = &cells_[pos & (kSize - 1)];
+    size_t seq = cell->sequence.Load(grpc_core::MemoryOrder::ACQUIRE);
+    intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.CompareExchangeWeak(&pos, pos + 1,
+                                           grpc_core::MemoryOrder::RELAXED,
+                                           grpc_core::MemoryOrder::RELAXED)) {
+        break;
+      }
+    } else if (diff < 0) {
+      /* the consumer of the previous lap has not freed this cell yet */
+      return false;
+    } else {
+      pos = enqueue_pos_.Load(grpc_core::MemoryOrder::RELAXED);
+    }
+  }
+  cell->data = c;
+  cell->sequence.Store(pos + 1, grpc_core::MemoryOrder::RELEASE);
+  return true;
+}
+
+grpc_cq_completion* CqEventRing::TryPop() {
+  size_t pos = dequeue_pos_.Load(grpc_core::MemoryOrder::RELAXED);
+  Cell* cell;
+  for (;;) {
+    cell = &cells_[pos & (kSize - 1)];
+    size_t seq = cell->sequence.Load(grpc_core::MemoryOrder::ACQUIRE);
+    intptr_t diff =
+        static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+    if (diff == 0) {
+      if (dequeue_pos_.CompareExchangeWeak(&pos, pos + 1,
+                                           grpc_core::MemoryOrder::RELAXED,
+                                           grpc_core::MemoryOrder::RELAXED)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return nullptr;
+    } else {
+      pos = dequeue_pos_.Load(grpc_core::MemoryOrder::RELAXED);
+    }
+  }
+  grpc_cq_completion* c = cell->data;
+  cell->sequence.Store(pos + kSize, grpc_core::MemoryOrder::RELEASE);
+  return c;
+}
+
 bool CqEventQueue::Push(grpc_cq_completion* c) {
-  queue_.Push(
-      reinterpret_cast<grpc_core::MultiProducerSingleConsumerQueue::Node*>(c));
+  if (ring_ == nullptr) {
+    queue_.Push(
+        reinterpret_cast<grpc_core::MultiProducerSingleConsumerQueue::Node*>(
+            c));
+  } else if (num_spilled_.Load(grpc_core::MemoryOrder::ACQUIRE) > 0 ||
+             !ring_->TryPush(c)) {
+    num_spilled_.FetchAdd(1, grpc_core::MemoryOrder::ACQ_REL);
+    queue_.Push(
+        reinterpret_cast<grpc_core::MultiProducerSingleConsumerQueue::Node*>(
+            c));
+  }
   return num_queue_items_.FetchAdd(1, grpc_core::MemoryOrder::RELAXED) == 0;
 }
 
 grpc_cq_completion* CqEventQueue::Pop() {
-  grpc_cq_completion* c = nullptr;
+  grpc_cq_completion* c = ring_ != nullptr ? ring_->TryPop() : nullptr;
 
-  if (gpr_spinlock_trylock(&queue_lock_)) {
+  if (c == nullptr && gpr_spinlock_trylock(&queue_lock_)) {
     GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_SUCCESSES();
 
     bool is_empty = false;
     c = reinterpret_cast<grpc_cq_completion*>(queue_.PopAndCheckEnd(&is_empty));
     gpr_spinlock_unlock(&queue_lock_);
 
+    if (c != nullptr && ring_ != nullptr) {
+      num_spilled_.FetchSub(1, grpc_core::MemoryOrder::ACQ_REL);
+    }
+
     if (c == nullptr && !is_empty) {
       GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES();
     }
-  } else {
+  } else if (c == nullptr) {
     GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_FAILURES();
   }
 
@@ -551,7 +678,7 @@ grpc_completion_queue* grpc_completion_queue_create_internal(
 static void cq_init_next(
     void* data,
     grpc_experimental_completion_queue_functor* /*shutdown_callback*/) {
-  new (data) cq_next_data();
+  new (data) cq_next_data(GPR_GLOBAL_CONFIG_GET(grpc_cq_next_ring));
 }
 
 static void cq_destroy_next(void* data) {
@@ -26,6 +26,7 @@
 #include <grpc/grpc.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/iomgr/pollset.h"
 
@@ -36,6 +37,8 @@ extern grpc_core::TraceFlag grpc_trace_operation_failures;
 extern grpc_core::DebugOnlyTraceFlag grpc_trace_pending_tags;
 extern grpc_core::DebugOnlyTraceFlag grpc_trace_cq_refcount;
 
+GPR_GLOBAL_CONFIG_DECLARE_BOOL(grpc_cq_next_ring);
+
 typedef struct grpc_cq_completion {
   grpc_core::ManualConstructor<grpc_core::MultiProducerSingleConsumerQueue>
       node;
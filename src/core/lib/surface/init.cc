@@ -42,6 +42,7 @@
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/executor.h"
+#include "src/core/lib/iomgr/executor/threadpool.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/iomgr/resource_quota.h"
 #include "src/core/lib/iomgr/timer_manager.h"
@@ -76,6 +77,7 @@ static void do_basic_init(void) {
   grpc_register_built_in_plugins();
   grpc_cq_global_init();
   grpc_core::grpc_executor_global_init();
+  grpc_core::WorkStealingThreadPool::GlobalInit();
   gpr_time_init();
   g_initializations = 0;
 }
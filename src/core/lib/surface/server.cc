@@ -40,6 +40,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/channel/connected_channel.h"
+#include "src/core/lib/compression/compression_args.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/gpr/string.h"
@@ -548,6 +549,14 @@ Server::Server(const grpc_channel_args* args)
 
 Server::~Server() {
   grpc_channel_args_destroy(channel_args_);
+  for (std::vector<RegisteredMethodSlot>* slots :
+       {&registered_method_slots_, &registered_method_overflow_}) {
+    for (const RegisteredMethodSlot& slot : *slots) {
+      if (slot.server_registered_method == nullptr) continue;
+      grpc_slice_unref_internal(slot.method);
+      if (slot.has_host) grpc_slice_unref_internal(slot.host);
+    }
+  }
   // Remove the cq pollsets from the config_fetcher.
   if (started_ && config_fetcher_ != nullptr &&
       config_fetcher_->interested_parties() != nullptr) {
@@ -585,6 +594,7 @@ void Server::Start() {
       rm->matcher = absl::make_unique<RealRequestMatcher>(this);
     }
   }
+  BuildRegisteredMethodTable();
   {
     MutexLock lock(&mu_global_);
     starting_ = true;
@@ -689,6 +699,11 @@ Server::RegisteredMethod* Server::RegisterMethod(
             "grpc_server_register_method method string cannot be NULL");
     return nullptr;
   }
+  if (started_) {
+    gpr_log(GPR_ERROR,
+            "grpc_server_register_method called after grpc_server_start");
+    return nullptr;
+  }
   for (std::unique_ptr<RegisteredMethod>& m : registered_methods_) {
     if (streq(m->method, method) && streq(m->host, host)) {
       gpr_log(GPR_ERROR, "duplicate registration for %s@%s", method,
@@ -706,6 +721,159 @@ Server::RegisteredMethod* Server::RegisterMethod(
   return registered_methods_.back().get();
 }
 
+namespace {
+
+// Tries this many seeds per bucket before giving up on placing the bucket in
+// the collision-free part of the registered method table.
+constexpr uint32_t kMaxRegisteredMethodSeed = 1 << 16;
+uint32_t g_max_registered_method_seed = kMaxRegisteredMethodSeed;
+
+// The slot of a registered method in a table of a power of two size: mixes
+// the hash of the method and host with the seed of its bucket (murmur3's
+// finalizer, so that every bit of the hash affects the slot).
+inline uint32_t RegisteredMethodSlotHash(uint32_t hash, uint32_t seed) {
+  uint32_t h = hash ^ (seed * 0x9e3779b9u);
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+}  // namespace
+
+uint32_t Server::SetMaxRegisteredMethodSeedForTesting(uint32_t max_seed) {
+  uint32_t old_max_seed = g_max_registered_method_seed;
+  g_max_registered_method_seed = max_seed;
+  return old_max_seed;
+}
+
+void Server::FillRegisteredMethodSlot(RegisteredMethod* rm,
+                                      RegisteredMethodSlot* slot) {
+  slot->server_registered_method = rm;
+  slot->flags = rm->flags;
+  slot->has_host = !rm->host.empty();
+  slot->method = ManagedMemorySlice(rm->method.c_str());
+  if (slot->has_host) {
+    slot->host = ManagedMemorySlice(rm->host.c_str());
+    has_host_registered_methods_ = true;
+  }
+}
+
+void Server::BuildRegisteredMethodTable() {
+  const size_t num_registered_methods = registered_methods_.size();
+  if (num_registered_methods == 0) return;
+  // Keep the load factor at or below 1/2, and have two keys per bucket on
+  // average so that a bucket is quick to place.
+  size_t num_slots = 1;
+  while (num_slots < 2 * num_registered_methods) num_slots <<= 1;
+  GPR_ASSERT(num_slots <= UINT32_MAX);
+  const size_t num_buckets = std::max<size_t>(1, num_slots / 4);
+  struct Key {
+    uint32_t hash;
+    RegisteredMethod* rm;
+  };
+  std::vector<std::vector<Key>> buckets(num_buckets);
+  for (std::unique_ptr<RegisteredMethod>& rm : registered_methods_) {
+    ExternallyManagedSlice method(rm->method.c_str());
+    uint32_t host_hash = 0;
+    if (!rm->host.empty()) {
+      host_hash = ExternallyManagedSlice(rm->host.c_str()).Hash();
+    }
+    uint32_t hash = GRPC_MDSTR_KV_HASH(host_hash, method.Hash());
+    buckets[hash & (num_buckets - 1)].push_back({hash, rm.get()});
+  }
+  // Place the largest buckets first, while the table is mostly empty.
+  std::vector<size_t> order(num_buckets);
+  for (size_t i = 0; i < num_buckets; i++) order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [&buckets](size_t a, size_t b) {
+    return buckets[a].size() > buckets[b].size();
+  });
+  registered_method_slots_.resize(num_slots);
+  registered_method_seeds_.assign(num_buckets, 0);
+  std::vector<bool> used(num_slots, false);
+  std::vector<uint32_t> positions;
+  for (size_t bucket_idx : order) {
+    const std::vector<Key>& bucket = buckets[bucket_idx];
+    if (bucket.empty()) break;
+    bool placed = false;
+    for (uint32_t seed = 0; seed < g_max_registered_method_seed && !placed;
+         seed++) {
+      positions.clear();
+      placed = true;
+      for (const Key& key : bucket) {
+        uint32_t pos =
+            RegisteredMethodSlotHash(key.hash, seed) & (num_slots - 1);
+        if (used[pos] || std::find(positions.begin(), positions.end(), pos) !=
+                             positions.end()) {
+          placed = false;
+          break;
+        }
+        positions.push_back(pos);
+      }
+      if (placed) registered_method_seeds_[bucket_idx] = seed;
+    }
+    if (placed) {
+      for (size_t i = 0; i < bucket.size(); i++) {
+        used[positions[i]] = true;
+        FillRegisteredMethodSlot(bucket[i].rm,
+                                 &registered_method_slots_[positions[i]]);
+      }
+    } else {
+      for (const Key& key : bucket) {
+        registered_method_overflow_.emplace_back();
+        FillRegisteredMethodSlot(key.rm, &registered_method_overflow_.back());
+      }
+    }
+  }
+}
+
+Server::RegisteredMethodSlot* Server::LookupRegisteredMethod(
+    uint32_t hash, const grpc_slice* host, const grpc_slice& path,
+    bool is_idempotent) {
+  auto matches = [host, &path, is_idempotent](const RegisteredMethodSlot& rm) {
+    if (rm.server_registered_method == nullptr) return false;
+    if (rm.has_host != (host != nullptr)) return false;
+    if (host != nullptr && rm.host != *host) return false;
+    if (rm.method != path) return false;
+    return !(rm.flags & GRPC_INITIAL_METADATA_IDEMPOTENT_REQUEST) ||
+           is_idempotent;
+  };
+  uint32_t seed =
+      registered_method_seeds_[hash & (registered_method_seeds_.size() - 1)];
+  RegisteredMethodSlot* rm =
+      &registered_method_slots_[RegisteredMethodSlotHash(hash, seed) &
+                                (registered_method_slots_.size() - 1)];
+  if (matches(*rm)) return rm;
+  for (RegisteredMethodSlot& overflow : registered_method_overflow_) {
+    if (matches(overflow)) return &overflow;
+  }
+  return nullptr;
+}
+
+Server::RegisteredMethod* Server::GetRegisteredMethod(const grpc_slice& host,
+                                                      const grpc_slice& path,
+                                                      bool is_idempotent) {
+  if (registered_method_slots_.empty()) return nullptr;
+  // Hashing an interned slice (e.g. a :path the HPACK parser interned) just
+  // reads the hash stored with it.
+  const uint32_t path_hash = grpc_slice_hash_internal(path);
+  RegisteredMethodSlot* rm = nullptr;
+  // check for an exact match with host
+  if (has_host_registered_methods_) {
+    rm = LookupRegisteredMethod(
+        GRPC_MDSTR_KV_HASH(grpc_slice_hash_internal(host), path_hash), &host,
+        path, is_idempotent);
+  }
+  // check for a wildcard method definition (no host set)
+  if (rm == nullptr) {
+    rm = LookupRegisteredMethod(GRPC_MDSTR_KV_HASH(0, path_hash), nullptr,
+                                path, is_idempotent);
+  }
+  return rm == nullptr ? nullptr : rm->server_registered_method;
+}
+
 void Server::DoneRequestEvent(void* req, grpc_cq_completion* /*c*/) {
   delete static_cast<RequestedCall*>(req);
 }
@@ -990,19 +1158,6 @@ class Server::ChannelData::ConnectivityWatcher
 //
 
 Server::ChannelData::~ChannelData() {
-  if (registered_methods_ != nullptr) {
-    for (const ChannelRegisteredMethod& crm : *registered_methods_) {
-      grpc_slice_unref_internal(crm.method);
-      GPR_DEBUG_ASSERT(crm.method.refcount == &kNoopRefcount ||
-                       crm.method.refcount == nullptr);
-      if (crm.has_host) {
-        grpc_slice_unref_internal(crm.host);
-        GPR_DEBUG_ASSERT(crm.host.refcount == &kNoopRefcount ||
-                         crm.host.refcount == nullptr);
-      }
-    }
-    registered_methods_.reset();
-  }
   if (server_ != nullptr) {
     if (server_->channelz_node_ != nullptr && channelz_socket_uuid_ != 0) {
       server_->channelz_node_->RemoveChildSocket(channelz_socket_uuid_);
@@ -1026,42 +1181,6 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
   channel_ = channel;
   cq_idx_ = cq_idx;
   channelz_socket_uuid_ = channelz_socket_uuid;
-  // Build a lookup table phrased in terms of mdstr's in this channels context
-  // to quickly find registered methods.
-  size_t num_registered_methods = server_->registered_methods_.size();
-  if (num_registered_methods > 0) {
-    uint32_t max_probes = 0;
-    size_t slots = 2 * num_registered_methods;
-    registered_methods_ =
-        absl::make_unique<std::vector<ChannelRegisteredMethod>>(slots);
-    for (std::unique_ptr<RegisteredMethod>& rm : server_->registered_methods_) {
-      ExternallyManagedSlice host;
-      ExternallyManagedSlice method(rm->method.c_str());
-      const bool has_host = !rm->host.empty();
-      if (has_host) {
-        host = ExternallyManagedSlice(rm->host.c_str());
-      }
-      uint32_t hash =
-          GRPC_MDSTR_KV_HASH(has_host ? host.Hash() : 0, method.Hash());
-      uint32_t probes = 0;
-      for (probes = 0; (*registered_methods_)[(hash + probes) % slots]
-                           .server_registered_method != nullptr;
-           probes++) {
-      }
-      if (probes > max_probes) max_probes = probes;
-      ChannelRegisteredMethod* crm =
-          &(*registered_methods_)[(hash + probes) % slots];
-      crm->server_registered_method = rm.get();
-      crm->flags = rm->flags;
-      crm->has_host = has_host;
-      if (has_host) {
-        crm->host = host;
-      }
-      crm->method = method;
-    }
-    GPR_ASSERT(slots <= UINT32_MAX);
-    registered_method_max_probes_ = max_probes;
-  }
   // Publish channel.
   {
     MutexLock lock(&server_->mu_global_);
@@ -1081,43 +1200,6 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
   grpc_transport_perform_op(transport, op);
 }
 
-Server::ChannelRegisteredMethod* Server::ChannelData::GetRegisteredMethod(
-    const grpc_slice& host, const grpc_slice& path, bool is_idempotent) {
-  if (registered_methods_ == nullptr) return nullptr;
-  /* TODO(ctiller): unify these two searches */
-  /* check for an exact match with host */
-  uint32_t hash = GRPC_MDSTR_KV_HASH(grpc_slice_hash_internal(host),
-                                     grpc_slice_hash_internal(path));
-  for (size_t i = 0; i <= registered_method_max_probes_; i++) {
-    ChannelRegisteredMethod* rm =
-        &(*registered_methods_)[(hash + i) % registered_methods_->size()];
-    if (rm->server_registered_method == nullptr) break;
-    if (!rm->has_host) continue;
-    if (rm->host != host) continue;
-    if (rm->method != path) continue;
-    if ((rm->flags & GRPC_INITIAL_METADATA_IDEMPOTENT_REQUEST) &&
-        !is_idempotent) {
-      continue;
-    }
-    return rm;
-  }
-  /* check for a wildcard method definition (no host set) */
-  hash = GRPC_MDSTR_KV_HASH(0, grpc_slice_hash_internal(path));
-  for (size_t i = 0; i <= registered_method_max_probes_; i++) {
-    ChannelRegisteredMethod* rm =
-        &(*registered_methods_)[(hash + i) % registered_methods_->size()];
-    if (rm->server_registered_method == nullptr) break;
-    if (rm->has_host) continue;
-    if (rm->method != path) continue;
-    if ((rm->flags & GRPC_INITIAL_METADATA_IDEMPOTENT_REQUEST) &&
-        !is_idempotent) {
-      continue;
-    }
-    return rm;
-  }
-  return nullptr;
-}
-
 void Server::ChannelData::AcceptStream(void* arg, grpc_transport* /*transport*/,
                                        const void* transport_server_data) {
   auto* chand = static_cast<Server::ChannelData*>(arg);
@@ -1313,7 +1395,6 @@ void Server::CallData::KillZombie() {
 }
 
 void Server::CallData::StartNewRpc(grpc_call_element* elem) {
-  auto* chand = static_cast<ChannelData*>(elem->channel_data);
   if (server_->ShutdownCalled()) {
     state_.Store(CallState::ZOMBIED, MemoryOrder::RELAXED);
     KillZombie();
@@ -1324,13 +1405,13 @@ void Server::CallData::StartNewRpc(grpc_call_element* elem) {
   grpc_server_register_method_payload_handling payload_handling =
       GRPC_SRM_PAYLOAD_NONE;
   if (path_.has_value() && host_.has_value()) {
-    ChannelRegisteredMethod* rm =
-        chand->GetRegisteredMethod(*host_, *path_,
-                                   (recv_initial_metadata_flags_ &
-                                    GRPC_INITIAL_METADATA_IDEMPOTENT_REQUEST));
+    RegisteredMethod* rm = server_->GetRegisteredMethod(
+        *host_, *path_,
+        (recv_initial_metadata_flags_ &
+         GRPC_INITIAL_METADATA_IDEMPOTENT_REQUEST));
     if (rm != nullptr) {
-      matcher_ = rm->server_registered_method->matcher.get();
-      payload_handling = rm->server_registered_method->payload_handling;
+      matcher_ = rm->matcher.get();
+      payload_handling = rm->payload_handling;
     }
   }
   // Start recv_message op if needed.
@@ -1479,7 +1560,12 @@ grpc_server* grpc_server_create(const grpc_channel_args* args, void* reserved) {
   grpc_core::ExecCtx exec_ctx;
   GRPC_API_TRACE("grpc_server_create(%p, %p)", 2, (args, reserved));
   grpc_server* c_server = new grpc_server;
-  c_server->core_server = grpc_core::MakeOrphanable<grpc_core::Server>(args);
+  // Load the compression dictionary once for all of the server's connections.
+  grpc_channel_args* new_args =
+      grpc_channel_args_load_compression_dictionary(args);
+  c_server->core_server = grpc_core::MakeOrphanable<grpc_core::Server>(
+      new_args != nullptr ? new_args : args);
+  grpc_channel_args_destroy(new_args);
   return c_server;
 }
 
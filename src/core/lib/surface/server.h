@@ -33,6 +33,7 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/iomgr/resolve_address.h"
+#include "src/core/lib/slice/slice_utils.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/transport/transport.h"
 
@@ -149,6 +150,17 @@ class Server : public InternallyRefCounted<Server> {
       grpc_server_register_method_payload_handling payload_handling,
       uint32_t flags);
 
+  // Returns the registered method that a call to \a path on \a host is
+  // dispatched to, or nullptr if there is none. Only valid after Start().
+  RegisteredMethod* GetRegisteredMethod(const grpc_slice& host,
+                                        const grpc_slice& path,
+                                        bool is_idempotent);
+
+  // Limits the seeds tried when placing a bucket of the registered method
+  // table of servers started from now on, so that tests can force methods
+  // into the overflow list. Returns the previous limit.
+  static uint32_t SetMaxRegisteredMethodSeedForTesting(uint32_t max_seed);
+
   grpc_call_error RequestCall(grpc_call** call, grpc_call_details* details,
                               grpc_metadata_array* request_metadata,
                               grpc_completion_queue* cq_bound_to_call,
@@ -170,12 +182,15 @@ class Server : public InternallyRefCounted<Server> {
  private:
   struct RequestedCall;
 
-  struct ChannelRegisteredMethod {
+  // An entry of the registered method table. The method and host are
+  // interned, so that a :path or :authority the HPACK parser interned is the
+  // very same slice and comparing them is a pointer comparison.
+  struct RegisteredMethodSlot {
     RegisteredMethod* server_registered_method = nullptr;
     uint32_t flags;
     bool has_host;
-    ExternallyManagedSlice method;
-    ExternallyManagedSlice host;
+    ManagedMemorySlice method;
+    ManagedMemorySlice host;
   };
 
   class RequestMatcherInterface;
@@ -197,10 +212,6 @@ class Server : public InternallyRefCounted<Server> {
     grpc_channel* channel() const { return channel_; }
     size_t cq_idx() const { return cq_idx_; }
 
-    ChannelRegisteredMethod* GetRegisteredMethod(const grpc_slice& host,
-                                                 const grpc_slice& path,
-                                                 bool is_idempotent);
-
     // Filter vtable functions.
     static grpc_error* InitChannelElement(grpc_channel_element* elem,
                                           grpc_channel_element_args* args);
@@ -222,12 +233,6 @@ class Server : public InternallyRefCounted<Server> {
     // where to publish new incoming calls.
     size_t cq_idx_;
     absl::optional<std::list<ChannelData*>::iterator> list_position_;
-    // A hash-table of the methods and hosts of the registered methods.
-    // TODO(vjpai): Convert this to an STL map type as opposed to a direct
-    // bucket implementation. (Consider performance impact, hash function to
-    // use, etc.)
-    std::unique_ptr<std::vector<ChannelRegisteredMethod>> registered_methods_;
-    uint32_t registered_method_max_probes_;
     grpc_closure finish_destroy_channel_closure_;
     intptr_t channelz_socket_uuid_;
   };
@@ -363,6 +368,14 @@ class Server : public InternallyRefCounted<Server> {
 
   std::vector<grpc_channel*> GetChannelsLocked() const;
 
+  void BuildRegisteredMethodTable();
+  void FillRegisteredMethodSlot(RegisteredMethod* rm,
+                                RegisteredMethodSlot* slot);
+  RegisteredMethodSlot* LookupRegisteredMethod(uint32_t hash,
+                                               const grpc_slice* host,
+                                               const grpc_slice& path,
+                                               bool is_idempotent);
+
   // Take a shutdown ref for a request (increment by 2) and return if shutdown
   // has already been called.
   bool ShutdownRefOnRequest() {
@@ -422,6 +435,19 @@ class Server : public InternallyRefCounted<Server> {
 
   std::vector<std::unique_ptr<RegisteredMethod>> registered_methods_;
 
+  // A collision-free hash table of registered_methods_ keyed on host and
+  // method, built by Start(). The slot of a key is chosen by mixing its hash
+  // with the seed of its bucket; the seeds are picked so that no two keys
+  // share a slot, making a lookup a single probe. Keys that could not be
+  // placed (only possible if their hashes fully collide) go to the overflow
+  // list, which is searched linearly.
+  std::vector<RegisteredMethodSlot> registered_method_slots_;
+  std::vector<uint32_t> registered_method_seeds_;
+  std::vector<RegisteredMethodSlot> registered_method_overflow_;
+  // Whether any method was registered for a specific host. If not, lookups
+  // skip the exact host match.
+  bool has_host_registered_methods_ = false;
+
   // Request matcher for unregistered methods.
   std::unique_ptr<RequestMatcherInterface> unregistered_request_matcher_;
 
@@ -141,6 +141,7 @@ bool grpc_error_has_clear_grpc_status(grpc_error* error) {
   if (grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &unused)) {
     return true;
   }
+  if (grpc_error_is_special(error)) return false;
   uint8_t slot = error->first_err;
   while (slot != UINT8_MAX) {
     grpc_linked_error* lerr =
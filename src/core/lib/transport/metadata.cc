@@ -29,6 +29,7 @@
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/time.h>
@@ -101,6 +102,11 @@ void grpc_mdelem_trace_unref(void* md, const grpc_slice& key,
 #define TABLE_IDX(hash, capacity) (((hash) >> (LOG2_SHARD_COUNT)) % (capacity))
 #define SHARD_IDX(hash) ((hash) & ((1 << (LOG2_SHARD_COUNT)) - 1))
 
+#define MDELEM_CACHE_SIZE 64
+#define MDELEM_CACHE_REF_BATCH 64
+#define MDELEM_CACHE_IDX(hash) \
+  (((hash) >> (LOG2_SHARD_COUNT)) % (MDELEM_CACHE_SIZE))
+
 void StaticMetadata::HashInit() {
   uint32_t k_hash = grpc_slice_hash_internal(kv_.key);
   uint32_t v_hash = grpc_slice_hash_internal(kv_.value);
@@ -229,7 +235,29 @@ typedef struct mdtab_shard {
 
 static mdtab_shard g_shards[SHARD_COUNT];
 
+/* Per-cpu front cache of recently created interned mdelems, consulted before
+   the shards. Each entry owns a batch of refs to its mdelem and hands them out
+   one per hit, so creating the same element again on the same cpu takes
+   neither the shard mutex nor an atomic on the shared refcount until the
+   batch runs dry. An entry always keeps at least one ref, which pins the
+   mdelem against gc_mdtab for as long as it is cached. */
+typedef struct mdelem_cache_entry {
+  InternedMetadata* md;
+  intptr_t refs;
+} mdelem_cache_entry;
+
+typedef struct mdelem_cache {
+  gpr_mu mu;
+  mdelem_cache_entry entries[MDELEM_CACHE_SIZE];
+  /* keeps neighbouring cpus' caches off each other's cache lines */
+  char padding[GPR_CACHELINE_SIZE];
+} mdelem_cache;
+
+static mdelem_cache* g_mdelem_caches;
+static size_t g_mdelem_cache_count;
+
 static void gc_mdtab(mdtab_shard* shard);
+static void mdelem_cache_flush(mdelem_cache* cache);
 
 void grpc_mdctx_global_init(void) {
   /* initialize shards */
@@ -242,9 +270,25 @@ void grpc_mdctx_global_init(void) {
     shard->elems = static_cast<InternedMetadata::BucketLink*>(
         gpr_zalloc(sizeof(*shard->elems) * shard->capacity));
   }
+  /* initialize per-cpu caches */
+  g_mdelem_cache_count = gpr_cpu_num_cores();
+  g_mdelem_caches = static_cast<mdelem_cache*>(
+      gpr_zalloc(sizeof(*g_mdelem_caches) * g_mdelem_cache_count));
+  for (size_t i = 0; i < g_mdelem_cache_count; i++) {
+    gpr_mu_init(&g_mdelem_caches[i].mu);
+  }
 }
 
 void grpc_mdctx_global_shutdown() {
+  /* return the refs held by the caches first, so that gc_mdtab below can
+     reclaim everything the application has released */
+  for (size_t i = 0; i < g_mdelem_cache_count; i++) {
+    mdelem_cache_flush(&g_mdelem_caches[i]);
+    gpr_mu_destroy(&g_mdelem_caches[i].mu);
+  }
+  gpr_free(g_mdelem_caches);
+  g_mdelem_caches = nullptr;
+  g_mdelem_cache_count = 0;
   for (size_t i = 0; i < SHARD_COUNT; i++) {
     mdtab_shard* shard = &g_shards[i];
     gpr_mu_destroy(&shard->mu);
@@ -351,6 +395,73 @@ static void rehash_mdtab(mdtab_shard* shard) {
   }
 }
 
+static void note_disposed_interned_metadata(uint32_t hash);
+
+static void mdelem_cache_release(const mdelem_cache_entry& entry) {
+  /* once the refcount hits zero, some other thread can come along and free md
+     at any time: read the hash first */
+  uint32_t hash = entry.md->hash();
+  if (entry.md->UnrefBatch(entry.refs)) {
+    note_disposed_interned_metadata(hash);
+  }
+}
+
+static void mdelem_cache_flush(mdelem_cache* cache) {
+  gpr_mu_lock(&cache->mu);
+  for (size_t i = 0; i < MDELEM_CACHE_SIZE; i++) {
+    mdelem_cache_entry* entry = &cache->entries[i];
+    if (entry->md != nullptr) {
+      mdelem_cache_release(*entry);
+      entry->md = nullptr;
+      entry->refs = 0;
+    }
+  }
+  gpr_mu_unlock(&cache->mu);
+}
+
+static mdelem_cache* mdelem_cache_for_current_cpu() {
+  return &g_mdelem_caches[gpr_cpu_current_cpu() % g_mdelem_cache_count];
+}
+
+/* Returns a ref to a cached mdelem for (key, value), or nullptr on a miss. */
+static InternedMetadata* mdelem_cache_lookup(mdelem_cache* cache,
+                                             const grpc_slice& key,
+                                             const grpc_slice& value,
+                                             uint32_t hash) {
+  InternedMetadata* md;
+  gpr_mu_lock(&cache->mu);
+  mdelem_cache_entry* entry = &cache->entries[MDELEM_CACHE_IDX(hash)];
+  md = entry->md;
+  if (md != nullptr && md->hash() == hash &&
+      grpc_slice_static_interned_equal(key, md->key()) &&
+      grpc_slice_static_interned_equal(value, md->value())) {
+    if (entry->refs == 1) {
+      md->RefBatch(MDELEM_CACHE_REF_BATCH);
+      entry->refs += MDELEM_CACHE_REF_BATCH;
+    }
+    entry->refs--;
+  } else {
+    md = nullptr;
+  }
+  gpr_mu_unlock(&cache->mu);
+  return md;
+}
+
+/* Caches md, which the caller holds a ref to, evicting whatever shared its
+   slot. */
+static void mdelem_cache_insert(mdelem_cache* cache, InternedMetadata* md) {
+  md->RefBatch(MDELEM_CACHE_REF_BATCH);
+  gpr_mu_lock(&cache->mu);
+  mdelem_cache_entry* entry = &cache->entries[MDELEM_CACHE_IDX(md->hash())];
+  mdelem_cache_entry evicted = *entry;
+  entry->md = md;
+  entry->refs = MDELEM_CACHE_REF_BATCH;
+  gpr_mu_unlock(&cache->mu);
+  if (evicted.md != nullptr) {
+    mdelem_cache_release(evicted);
+  }
+}
+
 template <bool key_definitely_static, bool value_definitely_static = false>
 static grpc_mdelem md_create_maybe_static(const grpc_slice& key,
                                           const grpc_slice& value);
@@ -450,6 +561,12 @@ static grpc_mdelem md_create_must_intern(const grpc_slice& key,
 
   GPR_TIMER_SCOPE("grpc_mdelem_from_metadata_strings", 0);
 
+  mdelem_cache* cache = mdelem_cache_for_current_cpu();
+  md = mdelem_cache_lookup(cache, key, value, hash);
+  if (md != nullptr) {
+    return GRPC_MAKE_MDELEM(md, GRPC_MDELEM_STORAGE_INTERNED);
+  }
+
   gpr_mu_lock(&shard->mu);
 
   idx = TABLE_IDX(hash, shard->capacity);
@@ -459,6 +576,7 @@ static grpc_mdelem md_create_must_intern(const grpc_slice& key,
         grpc_slice_static_interned_equal(value, md->value())) {
       md->RefWithShardLocked(shard);
       gpr_mu_unlock(&shard->mu);
+      mdelem_cache_insert(cache, md);
       return GRPC_MAKE_MDELEM(md, GRPC_MDELEM_STORAGE_INTERNED);
     }
   }
@@ -477,6 +595,7 @@ static grpc_mdelem md_create_must_intern(const grpc_slice& key,
   }
 
   gpr_mu_unlock(&shard->mu);
+  mdelem_cache_insert(cache, md);
 
   return GRPC_MAKE_MDELEM(md, GRPC_MDELEM_STORAGE_INTERNED);
 }
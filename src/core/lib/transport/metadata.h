@@ -260,6 +260,15 @@ class RefcountedMdBase {
     GPR_DEBUG_ASSERT(prior > 0);
     return prior == 1;
   }
+  /* take or drop n refs with a single atomic op: used by the per-cpu mdelem
+     cache in metadata.cc. As with Ref(), RefBatch() requires the caller to
+     already hold a ref. */
+  void RefBatch(intptr_t n) { refcnt_.FetchAdd(n, MemoryOrder::RELAXED); }
+  bool UnrefBatch(intptr_t n) {
+    const intptr_t prior = refcnt_.FetchSub(n, MemoryOrder::ACQ_REL);
+    GPR_DEBUG_ASSERT(prior >= n);
+    return prior == n;
+  }
 
  protected:
 #ifndef NDEBUG
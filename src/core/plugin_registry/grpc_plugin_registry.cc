@@ -78,6 +78,8 @@ void FileWatcherCertificateProviderShutdown();
 }  // namespace grpc_core
 void grpc_lb_policy_cds_init(void);
 void grpc_lb_policy_cds_shutdown(void);
+void grpc_lb_policy_ring_hash_init(void);
+void grpc_lb_policy_ring_hash_shutdown(void);
 void grpc_lb_policy_xds_cluster_impl_init(void);
 void grpc_lb_policy_xds_cluster_impl_shutdown(void);
 void grpc_lb_policy_xds_cluster_resolver_init(void);
@@ -144,6 +146,8 @@ void grpc_register_built_in_plugins(void) {
                        grpc_core::FileWatcherCertificateProviderShutdown);
   grpc_register_plugin(grpc_lb_policy_cds_init,
                        grpc_lb_policy_cds_shutdown);
+  grpc_register_plugin(grpc_lb_policy_ring_hash_init,
+                       grpc_lb_policy_ring_hash_shutdown);
   grpc_register_plugin(grpc_lb_policy_xds_cluster_impl_init,
                        grpc_lb_policy_xds_cluster_impl_shutdown);
   grpc_register_plugin(grpc_lb_policy_xds_cluster_resolver_init,
@@ -17,17 +17,65 @@
  */
 
 #include <grpc/support/cpu.h>
+#include <grpcpp/impl/codegen/grpc_library.h>
 
+#include "src/core/lib/gprpp/global_config.h"
+#include "src/core/lib/iomgr/executor/threadpool.h"
 #include "src/cpp/server/dynamic_thread_pool.h"
 
 #ifndef GRPC_CUSTOM_DEFAULT_THREAD_POOL
 
+GPR_GLOBAL_CONFIG_DEFINE_BOOL(
+    grpc_cpp_work_stealing_thread_pool, false,
+    "If set, the default C++ thread pools created from then on run callbacks "
+    "on a fixed-size grpc_core::WorkStealingThreadPool with one thread per "
+    "core, instead of a DynamicThreadPool that adds a thread whenever all of "
+    "its threads are busy.");
+
 namespace grpc {
 namespace {
 
+// Runs the callbacks of a ThreadPoolInterface on a
+// grpc_core::WorkStealingThreadPool.
+class WorkStealingThreadPoolAdapter final : public ThreadPoolInterface,
+                                            private GrpcLibraryCodegen {
+ public:
+  explicit WorkStealingThreadPoolAdapter(int num_threads)
+      : pool_(num_threads, "grpcpp_work_stealing") {}
+
+  void Add(const std::function<void()>& callback) override {
+    pool_.Add(new Closure(callback));
+  }
+
+ private:
+  // Owns a copy of a callback and deletes itself once it has run.
+  struct Closure : public grpc_experimental_completion_queue_functor {
+    explicit Closure(const std::function<void()>& cb) : callback(cb) {
+      functor_run = &Closure::Run;
+      inlineable = false;
+      internal_success = 1;
+      internal_next = nullptr;
+    }
+
+    static void Run(grpc_experimental_completion_queue_functor* functor,
+                    int /*ok*/) {
+      Closure* closure = static_cast<Closure*>(functor);
+      closure->callback();
+      delete closure;
+    }
+
+    std::function<void()> callback;
+  };
+
+  grpc_core::WorkStealingThreadPool pool_;
+};
+
 ThreadPoolInterface* CreateDefaultThreadPoolImpl() {
   int cores = gpr_cpu_num_cores();
   if (!cores) cores = 4;
+  if (GPR_GLOBAL_CONFIG_GET(grpc_cpp_work_stealing_thread_pool)) {
+    return new WorkStealingThreadPoolAdapter(cores);
+  }
   return new DynamicThreadPool(cores);
 }
 
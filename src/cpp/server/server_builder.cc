@@ -170,6 +170,21 @@ ServerBuilder& ServerBuilder::SetSyncServerOption(
     case CQ_TIMEOUT_MSEC:
       sync_server_settings_.cq_timeout_msec = val;
       break;
+    case HANDLER_THREADS:
+      if (val < 0) {
+        gpr_log(GPR_ERROR, "Invalid number of handler threads %d, using 0",
+                val);
+        val = 0;
+      }
+      sync_server_settings_.num_handler_threads = val;
+      break;
+    case HANDLER_QUEUE_SIZE:
+      if (val < 1) {
+        gpr_log(GPR_ERROR, "Invalid handler queue size %d, using 1", val);
+        val = 1;
+      }
+      sync_server_settings_.handler_queue_size = val;
+      break;
   }
   return *this;
 }
@@ -328,10 +343,13 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
     // This is a Sync server
     gpr_log(GPR_INFO,
             "Synchronous server. Num CQs: %d, Min pollers: %d, Max Pollers: "
-            "%d, CQ timeout (msec): %d",
+            "%d, CQ timeout (msec): %d, Handler threads: %d, Handler queue "
+            "size: %d",
             sync_server_settings_.num_cqs, sync_server_settings_.min_pollers,
             sync_server_settings_.max_pollers,
-            sync_server_settings_.cq_timeout_msec);
+            sync_server_settings_.cq_timeout_msec,
+            sync_server_settings_.num_handler_threads,
+            sync_server_settings_.handler_queue_size);
   }
 
   if (has_callback_methods) {
@@ -341,7 +359,9 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
   std::unique_ptr<grpc::Server> server(new grpc::Server(
       &args, sync_server_cqs, sync_server_settings_.min_pollers,
       sync_server_settings_.max_pollers, sync_server_settings_.cq_timeout_msec,
-      std::move(acceptors_), server_config_fetcher_, resource_quota_,
+      sync_server_settings_.num_handler_threads,
+      sync_server_settings_.handler_queue_size, std::move(acceptors_),
+      server_config_fetcher_, resource_quota_,
       std::move(interceptor_creators_)));
 
   ServerInitializer* initializer = server->initializer();
@@ -17,6 +17,7 @@
 
 #include <grpcpp/server.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <sstream>
 #include <type_traits>
@@ -406,8 +407,8 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
       // Set interception point for RECV MESSAGE
       auto* handler = resources_ ? method_->handler()
                                  : server_->resource_exhausted_handler_.get();
-      deserialized_request_ = handler->Deserialize(call_, request_payload_,
-                                                   &request_status_, nullptr);
+      deserialized_request_ = handler->Deserialize(
+          call_, request_payload_, &request_status_, &handler_data_);
 
       request_payload_ = nullptr;
       interceptor_methods_.AddInterceptionHookPoint(
@@ -431,7 +432,7 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
                                : server_->resource_exhausted_handler_.get();
     handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
         &*wrapped_call_, &ctx_->ctx, deserialized_request_, request_status_,
-        nullptr, nullptr));
+        handler_data_, nullptr));
     global_callbacks_->PostSynchronousRequest(&ctx_->ctx);
 
     cq_.Shutdown();
@@ -490,6 +491,7 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   std::shared_ptr<GlobalCallbacks> global_callbacks_;
   bool resources_;
   void* deserialized_request_ = nullptr;
+  void* handler_data_ = nullptr;
   grpc::internal::InterceptorBatchMethodsImpl interceptor_methods_;
 
   // ServerContextWrapper allows ManualConstructor while using a private
@@ -748,8 +750,10 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
   SyncRequestThreadManager(Server* server, grpc::CompletionQueue* server_cq,
                            std::shared_ptr<GlobalCallbacks> global_callbacks,
                            grpc_resource_quota* rq, int min_pollers,
-                           int max_pollers, int cq_timeout_msec)
-      : ThreadManager("SyncServer", rq, min_pollers, max_pollers),
+                           int max_pollers, int cq_timeout_msec,
+                           int num_handler_threads, int handler_queue_size)
+      : ThreadManager("SyncServer", rq, min_pollers, max_pollers,
+                      num_handler_threads, handler_queue_size),
         server_(server),
         server_cq_(server_cq),
         cq_timeout_msec_(cq_timeout_msec),
@@ -850,6 +854,7 @@ Server::Server(
     std::shared_ptr<std::vector<std::unique_ptr<grpc::ServerCompletionQueue>>>
         sync_server_cqs,
     int min_pollers, int max_pollers, int sync_cq_timeout_msec,
+    int num_handler_threads, int handler_queue_size,
     std::vector<std::shared_ptr<grpc::internal::ExternalConnectionAcceptorImpl>>
         acceptors,
     grpc_server_config_fetcher* server_config_fetcher,
@@ -884,7 +889,8 @@ Server::Server(
     for (const auto& it : *sync_server_cqs_) {
       sync_req_mgrs_.emplace_back(new SyncRequestThreadManager(
           this, it.get(), global_callbacks_, server_rq, min_pollers,
-          max_pollers, sync_cq_timeout_msec));
+          max_pollers, sync_cq_timeout_msec, num_handler_threads,
+          handler_queue_size));
     }
 
     if (default_rq_created) {
@@ -978,6 +984,24 @@ Server::experimental_type::InProcessChannelWithInterceptors(
       std::move(interceptor_creators));
 }
 
+Server::experimental_type::HandlerPoolStats
+Server::experimental_type::GetHandlerPoolStats() {
+  HandlerPoolStats stats;
+  for (const auto& mgr : server_->sync_req_mgrs_) {
+    const grpc::ThreadManager::HandlerPoolStats mgr_stats =
+        mgr->GetHandlerPoolStats();
+    stats.queue_depth += mgr_stats.queue_depth;
+    stats.max_queue_depth =
+        std::max(stats.max_queue_depth, mgr_stats.max_queue_depth);
+    stats.num_dispatched += mgr_stats.num_dispatched;
+    stats.num_rejected += mgr_stats.num_rejected;
+    stats.total_wait_usec += mgr_stats.total_wait_usec;
+    stats.max_wait_usec =
+        std::max(stats.max_wait_usec, mgr_stats.max_wait_usec);
+  }
+  return stats;
+}
+
 static grpc_server_register_method_payload_handling PayloadHandlingForMethod(
     grpc::internal::RpcServiceMethod* method) {
   switch (method->method_type()) {
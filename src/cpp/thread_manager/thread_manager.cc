@@ -26,12 +26,13 @@
 
 namespace grpc {
 
-ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
-    : thd_mgr_(thd_mgr) {
+ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr,
+                                          bool is_handler)
+    : thd_mgr_(thd_mgr), is_handler_(is_handler) {
   // Make thread creation exclusive with respect to its join happening in
   // ~WorkerThread().
   thd_ = grpc_core::Thread(
-      "grpcpp_sync_server",
+      is_handler ? "grpcpp_sync_handler" : "grpcpp_sync_server",
       [](void* th) { static_cast<ThreadManager::WorkerThread*>(th)->Run(); },
       this, &created_);
   if (!created_) {
@@ -40,7 +41,13 @@ ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
 }
 
 void ThreadManager::WorkerThread::Run() {
-  thd_mgr_->MainWorkLoop();
+  if (is_handler_) {
+    thd_mgr_->HandlerWorkLoop();
+  } else if (thd_mgr_->num_handler_threads_ > 0) {
+    thd_mgr_->PollerWorkLoop();
+  } else {
+    thd_mgr_->MainWorkLoop();
+  }
   thd_mgr_->MarkAsCompleted(this);
 }
 
@@ -51,13 +58,20 @@ ThreadManager::WorkerThread::~WorkerThread() {
 
 ThreadManager::ThreadManager(const char* name,
                              grpc_resource_quota* resource_quota,
-                             int min_pollers, int max_pollers)
+                             int min_pollers, int max_pollers,
+                             int num_handler_threads,
+                             int max_handler_queue_size)
     : shutdown_(false),
       num_pollers_(0),
       min_pollers_(min_pollers),
       max_pollers_(max_pollers == -1 ? INT_MAX : max_pollers),
       num_threads_(0),
-      max_active_threads_sofar_(0) {
+      max_active_threads_sofar_(0),
+      num_handler_threads_(num_handler_threads),
+      max_handler_queue_size_(max_handler_queue_size > 0
+                                  ? static_cast<size_t>(max_handler_queue_size)
+                                  : SIZE_MAX),
+      num_live_pollers_(0) {
   resource_user_ = grpc_resource_user_create(resource_quota, name);
 }
 
@@ -94,6 +108,11 @@ int ThreadManager::GetMaxActiveThreadsSoFar() {
   return max_active_threads_sofar_;
 }
 
+ThreadManager::HandlerPoolStats ThreadManager::GetHandlerPoolStats() {
+  grpc_core::MutexLock lock(&work_mu_);
+  return handler_stats_;
+}
+
 void ThreadManager::MarkAsCompleted(WorkerThread* thd) {
   {
     grpc_core::MutexLock list_lock(&list_mu_);
@@ -124,23 +143,35 @@ void ThreadManager::CleanupCompletedThreads() {
 }
 
 void ThreadManager::Initialize() {
-  if (!grpc_resource_user_allocate_threads(resource_user_, min_pollers_)) {
+  // With a handler pool, all of the threads are created up front
+  const int num_threads = min_pollers_ + num_handler_threads_;
+  if (!grpc_resource_user_allocate_threads(resource_user_, num_threads)) {
     gpr_log(GPR_ERROR,
             "No thread quota available to even create the minimum required "
-            "polling threads (i.e %d). Unable to start the thread manager",
-            min_pollers_);
+            "polling and handler threads (i.e %d). Unable to start the thread "
+            "manager",
+            num_threads);
     abort();
   }
 
   {
     grpc_core::MutexLock lock(&mu_);
     num_pollers_ = min_pollers_;
-    num_threads_ = min_pollers_;
-    max_active_threads_sofar_ = min_pollers_;
+    num_threads_ = num_threads;
+    max_active_threads_sofar_ = num_threads;
+  }
+  {
+    grpc_core::MutexLock lock(&work_mu_);
+    num_live_pollers_ = min_pollers_;
   }
 
+  for (int i = 0; i < num_handler_threads_; i++) {
+    WorkerThread* worker = new WorkerThread(this, /*is_handler=*/true);
+    GPR_ASSERT(worker->created());  // Must be able to create the whole pool
+    worker->Start();
+  }
   for (int i = 0; i < min_pollers_; i++) {
-    WorkerThread* worker = new WorkerThread(this);
+    WorkerThread* worker = new WorkerThread(this, /*is_handler=*/false);
     GPR_ASSERT(worker->created());  // Must be able to create the minimum
     worker->Start();
   }
@@ -180,7 +211,8 @@ void ThreadManager::MainWorkLoop() {
             }
             // Drop lock before spawning thread to avoid contention
             lock.Release();
-            WorkerThread* worker = new WorkerThread(this);
+            WorkerThread* worker =
+                new WorkerThread(this, /*is_handler=*/false);
             if (worker->created()) {
               worker->Start();
             } else {
@@ -262,4 +294,75 @@ void ThreadManager::MainWorkLoop() {
   // enough threads.
 }
 
+void ThreadManager::PollerWorkLoop() {
+  // Unlike MainWorkLoop(), the set of pollers is fixed: a poller never does
+  // the application work itself (unless the handler queue is full) and so
+  // there is never a need to spawn a replacement for it.
+  while (true) {
+    void* tag;
+    bool ok;
+    WorkStatus work_status = PollForWork(&tag, &ok);
+    if (work_status == SHUTDOWN) break;
+    if (work_status == WORK_FOUND && !EnqueueWork(tag, ok)) {
+      // Every handler thread is busy and the queue is at its limit; fail the
+      // work rather than letting the backlog grow without bound.
+      DoWork(tag, ok, false);
+    }
+    if (IsShutdown()) break;
+  }
+
+  {
+    grpc_core::MutexLock lock(&work_mu_);
+    num_live_pollers_--;
+    if (num_live_pollers_ == 0) {
+      // Wake up the idle handler threads so that they can exit
+      work_cv_.SignalAll();
+    }
+  }
+
+  CleanupCompletedThreads();
+}
+
+bool ThreadManager::EnqueueWork(void* tag, bool ok) {
+  grpc_core::MutexLock lock(&work_mu_);
+  if (work_queue_.size() >= max_handler_queue_size_) {
+    handler_stats_.num_rejected++;
+    return false;
+  }
+  work_queue_.push_back({tag, ok, gpr_now(GPR_CLOCK_MONOTONIC)});
+  handler_stats_.queue_depth = work_queue_.size();
+  if (handler_stats_.queue_depth > handler_stats_.max_queue_depth) {
+    handler_stats_.max_queue_depth = handler_stats_.queue_depth;
+  }
+  work_cv_.Signal();
+  return true;
+}
+
+void ThreadManager::HandlerWorkLoop() {
+  while (true) {
+    PendingWork work;
+    {
+      grpc_core::MutexLock lock(&work_mu_);
+      while (work_queue_.empty() && num_live_pollers_ > 0) {
+        work_cv_.Wait(&work_mu_);
+      }
+      // The pollers are gone and nothing is left to run
+      if (work_queue_.empty()) break;
+      work = work_queue_.front();
+      work_queue_.pop_front();
+      handler_stats_.queue_depth = work_queue_.size();
+      handler_stats_.num_dispatched++;
+      int64_t wait_usec = static_cast<int64_t>(gpr_timespec_to_micros(
+          gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), work.enqueue_time)));
+      handler_stats_.total_wait_usec += wait_usec;
+      if (wait_usec > handler_stats_.max_wait_usec) {
+        handler_stats_.max_wait_usec = wait_usec;
+      }
+    }
+    DoWork(work.tag, work.ok, true);
+  }
+
+  CleanupCompletedThreads();
+}
+
 }  // namespace grpc
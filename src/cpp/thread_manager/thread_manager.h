@@ -19,9 +19,13 @@
 #ifndef GRPC_INTERNAL_CPP_THREAD_MANAGER_H
 #define GRPC_INTERNAL_CPP_THREAD_MANAGER_H
 
+#include <stdint.h>
+
+#include <deque>
 #include <list>
 #include <memory>
 
+#include <grpc/support/time.h>
 #include <grpcpp/support/config.h>
 
 #include "src/core/lib/gprpp/sync.h"
@@ -32,8 +36,16 @@ namespace grpc {
 
 class ThreadManager {
  public:
+  // If num_handler_threads is zero, every thread both polls and does the work
+  // it found, and the number of threads varies between min_pollers and
+  // max_pollers. Otherwise exactly min_pollers threads poll and hand the work
+  // off to a fixed pool of num_handler_threads threads, through a queue holding
+  // at most max_handler_queue_size items (unbounded if not positive);
+  // max_pollers is then unused.
   explicit ThreadManager(const char* name, grpc_resource_quota* resource_quota,
-                         int min_pollers, int max_pollers);
+                         int min_pollers, int max_pollers,
+                         int num_handler_threads = 0,
+                         int max_handler_queue_size = 0);
   virtual ~ThreadManager();
 
   // Initializes and Starts the Rpc Manager threads
@@ -92,6 +104,22 @@ class ThreadManager {
   // to check if resource_quota is properly being enforced.
   int GetMaxActiveThreadsSoFar();
 
+  // Counters of the handler pool. All zero if num_handler_threads is zero.
+  struct HandlerPoolStats {
+    // Number of work items currently waiting for a handler thread, and the
+    // largest number ever waiting
+    size_t queue_depth = 0;
+    size_t max_queue_depth = 0;
+    // Number of work items run by a handler thread, and the number run by the
+    // poller with resources == false because the queue was full
+    int64_t num_dispatched = 0;
+    int64_t num_rejected = 0;
+    // Total and largest time that dispatched items spent in the queue
+    int64_t total_wait_usec = 0;
+    int64_t max_wait_usec = 0;
+  };
+  HandlerPoolStats GetHandlerPoolStats();
+
  private:
   // Helper wrapper class around grpc_core::Thread. Takes a ThreadManager object
   // and starts a new grpc_core::Thread to calls the Run() function.
@@ -119,18 +147,20 @@ class ThreadManager {
   // not be called (and the need for this WorkerThread class is eliminated)
   class WorkerThread {
    public:
-    explicit WorkerThread(ThreadManager* thd_mgr);
+    WorkerThread(ThreadManager* thd_mgr, bool is_handler);
     ~WorkerThread();
 
     bool created() const { return created_; }
     void Start() { thd_.Start(); }
 
    private:
-    // Calls thd_mgr_->MainWorkLoop() and once that completes, calls
+    // Calls thd_mgr_->MainWorkLoop() (or HandlerWorkLoop() if this is a
+    // handler pool thread) and once that completes, calls
     // thd_mgr_>MarkAsCompleted(this) to mark the thread as completed
     void Run();
 
     ThreadManager* const thd_mgr_;
+    const bool is_handler_;
     grpc_core::Thread thd_;
     bool created_;
   };
@@ -138,6 +168,15 @@ class ThreadManager {
   // The main function in ThreadManager
   void MainWorkLoop();
 
+  // The loop of the pollers and of the handler threads when the handler pool
+  // is in use
+  void PollerWorkLoop();
+  void HandlerWorkLoop();
+
+  // Hands work found by a poller to the handler pool. Returns false if the
+  // queue is full.
+  bool EnqueueWork(void* tag, bool ok);
+
   void MarkAsCompleted(WorkerThread* thd);
   void CleanupCompletedThreads();
 
@@ -174,6 +213,25 @@ class ThreadManager {
 
   grpc_core::Mutex list_mu_;
   std::list<WorkerThread*> completed_threads_;
+
+  // Size of the handler pool (zero if not in use) and the bound of its queue
+  const int num_handler_threads_;
+  const size_t max_handler_queue_size_;
+
+  struct PendingWork {
+    void* tag;
+    bool ok;
+    gpr_timespec enqueue_time;
+  };
+
+  // Protects the handler pool queue, its statistics and num_live_pollers_
+  grpc_core::Mutex work_mu_;
+  grpc_core::CondVar work_cv_;
+  std::deque<PendingWork> work_queue_;
+  // Number of pollers that have not exited yet. Handler threads exit once this
+  // drops to zero and the queue is drained.
+  int num_live_pollers_;
+  HandlerPoolStats handler_stats_;
 };
 
 }  // namespace grpc
@@ -53,6 +53,24 @@ static void test_create(void) {
   grpc_channel_args_destroy(ch_args);
 }
 
+static void test_hash(void) {
+  grpc_arg args[3];
+  args[0] = grpc_channel_arg_integer_create(const_cast<char*>("int_arg"), 123);
+  args[1] = grpc_channel_arg_string_create(const_cast<char*>("str key"),
+                                           const_cast<char*>("str value"));
+  args[2] = grpc_channel_arg_integer_create(const_cast<char*>("int_arg"), 456);
+  grpc_channel_args a = {2, args};
+  grpc_channel_args b = {2, args + 1};
+  grpc_channel_args* a_copy = grpc_channel_args_copy(&a);
+
+  GPR_ASSERT(grpc_channel_args_compare(&a, a_copy) == 0);
+  GPR_ASSERT(grpc_channel_args_hash(&a) == grpc_channel_args_hash(a_copy));
+  GPR_ASSERT(grpc_channel_args_compare(&a, &b) != 0);
+  GPR_ASSERT(grpc_channel_args_hash(nullptr) == 0);
+
+  grpc_channel_args_destroy(a_copy);
+}
+
 struct fake_class {
   int foo;
 };
@@ -203,6 +221,7 @@ int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
   test_create();
+  test_hash();
   test_channel_create_with_args();
   test_server_create_with_args();
   // This has to be the last test.
@@ -535,6 +535,32 @@ TEST(ChannelzServerTest, BasicServerAPIFunctionality) {
   ValidateServer(channelz_server, {3, 3, 3});
 }
 
+TEST(ChannelzSocketTest, HpackHeaderBytesOptions) {
+  grpc_core::ExecCtx exec_ctx;
+  SocketNode socket("ipv4:127.0.0.1:1", "ipv4:127.0.0.1:2", "test-socket",
+                    nullptr);
+  // Nothing is reported before any header block was encoded.
+  Json json = socket.RenderJson();
+  const Json::Object& empty_data =
+      json.object_value().at("data").object_value();
+  EXPECT_EQ(empty_data.find("option"), empty_data.end());
+  socket.RecordHeadersEncoded(100, 40);
+  socket.RecordHeadersEncoded(100, 10);
+  json = socket.RenderJson();
+  const Json::Object& data = json.object_value().at("data").object_value();
+  auto it = data.find("option");
+  ASSERT_NE(it, data.end());
+  ASSERT_EQ(it->second.type(), Json::Type::ARRAY);
+  const Json::Array& options = it->second.array_value();
+  ASSERT_EQ(options.size(), 2u);
+  EXPECT_EQ(options[0].object_value().at("name").string_value(),
+            "grpc.hpack.header_bytes_uncompressed");
+  EXPECT_EQ(options[0].object_value().at("value").string_value(), "200");
+  EXPECT_EQ(options[1].object_value().at("name").string_value(),
+            "grpc.hpack.header_bytes_encoded");
+  EXPECT_EQ(options[1].object_value().at("value").string_value(), "50");
+}
+
 TEST_F(ChannelzRegistryBasedTest, BasicGetServersTest) {
   grpc_core::ExecCtx exec_ctx;
   ServerFixture server;
@@ -16,26 +16,31 @@
  *
  */
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <grpc/compression.h>
 #include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/compression/compression_args.h"
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/gpr/tmpfile.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/util/test_config.h"
 
 static void test_compression_algorithm_parse(void) {
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate", "stream/gzip"};
+  const char* valid_names[] = {"identity", "gzip",        "deflate",
+                               "zstd",     "lz4",         "stream/gzip"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
-      GRPC_COMPRESS_STREAM_GZIP};
-  const char* invalid_names[] = {"gzip2", "foo", "", "2gzip"};
+      GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4,  GRPC_COMPRESS_STREAM_GZIP};
+  const char* invalid_names[] = {"gzip2", "foo", "", "2gzip", "zstd2", "lz"};
 
   gpr_log(GPR_DEBUG, "test_compression_algorithm_parse");
 
@@ -63,10 +68,11 @@ static void test_compression_algorithm_name(void) {
   int success;
   const char* name;
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate", "stream/gzip"};
+  const char* valid_names[] = {"identity", "gzip",        "deflate",
+                               "zstd",     "lz4",         "stream/gzip"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
-      GRPC_COMPRESS_STREAM_GZIP};
+      GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4,  GRPC_COMPRESS_STREAM_GZIP};
 
   gpr_log(GPR_DEBUG, "test_compression_algorithm_name");
 
@@ -200,6 +206,32 @@ static void test_compression_algorithm_for_level(void) {
                                                     accepted_encodings));
   }
 
+  {
+    /* accept lz4 and zstd: only those that were built in can be picked */
+    const uint32_t available = grpc_compression_algorithms_available_bitset();
+    const bool has_zstd = GPR_BITGET(available, GRPC_COMPRESS_ZSTD) != 0;
+    const bool has_lz4 = GPR_BITGET(available, GRPC_COMPRESS_LZ4) != 0;
+    uint32_t accepted_encodings = 0;
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_NONE); /* always */
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_ZSTD);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_LZ4);
+
+    GPR_ASSERT(GRPC_COMPRESS_NONE ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_NONE,
+                                                    accepted_encodings));
+
+    const grpc_compression_algorithm low =
+        has_lz4 ? GRPC_COMPRESS_LZ4
+                : (has_zstd ? GRPC_COMPRESS_ZSTD : GRPC_COMPRESS_NONE);
+    const grpc_compression_algorithm high =
+        has_zstd ? GRPC_COMPRESS_ZSTD
+                 : (has_lz4 ? GRPC_COMPRESS_LZ4 : GRPC_COMPRESS_NONE);
+    GPR_ASSERT(low == grpc_compression_algorithm_for_level(
+                          GRPC_COMPRESS_LEVEL_LOW, accepted_encodings));
+    GPR_ASSERT(high == grpc_compression_algorithm_for_level(
+                           GRPC_COMPRESS_LEVEL_HIGH, accepted_encodings));
+  }
+
   {
     /* accept all algorithms */
     uint32_t accepted_encodings = 0;
@@ -275,6 +307,51 @@ static void test_channel_args_set_compression_algorithm(void) {
   grpc_channel_args_destroy(ch_args);
 }
 
+static void test_channel_args_load_compression_dictionary(void) {
+  grpc_core::ExecCtx exec_ctx;
+  static const char kDictionary[] = "grpc-status grpc-message content-type";
+  char* dictionary_path;
+  FILE* dictionary_file =
+      gpr_tmpfile("compression_test_dictionary", &dictionary_path);
+  GPR_ASSERT(dictionary_file != nullptr);
+  GPR_ASSERT(fwrite(kDictionary, 1, sizeof(kDictionary) - 1, dictionary_file) ==
+             sizeof(kDictionary) - 1);
+  fclose(dictionary_file);
+
+  /* nothing to load without a file */
+  grpc_channel_args* ch_args =
+      grpc_channel_args_copy_and_add(nullptr, nullptr, 0);
+  GPR_ASSERT(grpc_channel_args_load_compression_dictionary(ch_args) == nullptr);
+  GPR_ASSERT(grpc_core::CompressionDictionary::GetFromChannelArgs(ch_args) ==
+             nullptr);
+  grpc_channel_args_destroy(ch_args);
+
+  grpc_arg arg = grpc_channel_arg_string_create(
+      const_cast<char*>(GRPC_COMPRESSION_CHANNEL_DICTIONARY_FILE),
+      dictionary_path);
+  ch_args = grpc_channel_args_copy_and_add(nullptr, &arg, 1);
+  grpc_channel_args* loaded_args =
+      grpc_channel_args_load_compression_dictionary(ch_args);
+  GPR_ASSERT(loaded_args != nullptr);
+  grpc_core::RefCountedPtr<grpc_core::CompressionDictionary> dictionary =
+      grpc_core::CompressionDictionary::GetFromChannelArgs(loaded_args);
+  GPR_ASSERT(dictionary != nullptr);
+  GPR_ASSERT(grpc_slice_str_cmp(dictionary->data(), kDictionary) == 0);
+
+  /* copies of the args share the loaded dictionary instead of reloading it */
+  grpc_channel_args* copied_args = grpc_channel_args_copy(loaded_args);
+  GPR_ASSERT(grpc_channel_args_load_compression_dictionary(copied_args) ==
+             nullptr);
+  GPR_ASSERT(grpc_core::CompressionDictionary::GetFromChannelArgs(
+                 copied_args) == dictionary);
+
+  grpc_channel_args_destroy(copied_args);
+  grpc_channel_args_destroy(loaded_args);
+  grpc_channel_args_destroy(ch_args);
+  remove(dictionary_path);
+  gpr_free(dictionary_path);
+}
+
 static void test_channel_args_compression_algorithm_states(void) {
   grpc_core::ExecCtx exec_ctx;
   grpc_channel_args *ch_args, *ch_args_wo_gzip, *ch_args_wo_gzip_deflate,
@@ -335,6 +412,47 @@ static void test_channel_args_compression_algorithm_states(void) {
   grpc_channel_args_destroy(ch_args);
 }
 
+static void test_compression_bitset_conversion(void) {
+  gpr_log(GPR_DEBUG, "test_compression_bitset_conversion");
+
+  /* zstd and lz4 were appended: the values of the older algorithms, and so
+   * the bitsets built from them, must not change */
+  GPR_ASSERT(GRPC_COMPRESS_STREAM_GZIP == 3);
+  GPR_ASSERT(GRPC_COMPRESS_ZSTD == 4);
+  GPR_ASSERT(GRPC_COMPRESS_LZ4 == 5);
+
+  for (uint32_t bitset = 0; bitset < (1u << GRPC_COMPRESS_ALGORITHMS_COUNT);
+       bitset++) {
+    const uint32_t message_bitset =
+        grpc_compression_bitset_to_message_bitset(bitset);
+    const uint32_t stream_bitset =
+        grpc_compression_bitset_to_stream_bitset(bitset);
+    for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+      const grpc_compression_algorithm algorithm =
+          static_cast<grpc_compression_algorithm>(i);
+      if (algorithm == GRPC_COMPRESS_NONE) continue;
+      if (grpc_compression_algorithm_is_message(algorithm)) {
+        const grpc_message_compression_algorithm message_algorithm =
+            grpc_compression_algorithm_to_message_compression_algorithm(
+                algorithm);
+        GPR_ASSERT(GPR_BITGET(bitset, i) ==
+                   GPR_BITGET(message_bitset, message_algorithm));
+      } else {
+        GPR_ASSERT(grpc_compression_algorithm_is_stream(algorithm));
+        const grpc_stream_compression_algorithm stream_algorithm =
+            grpc_compression_algorithm_to_stream_compression_algorithm(
+                algorithm);
+        GPR_ASSERT(GPR_BITGET(bitset, i) ==
+                   GPR_BITGET(stream_bitset, stream_algorithm));
+      }
+    }
+    /* NONE is kept in both halves, so the bitset round-trips */
+    GPR_ASSERT((bitset | 1u) ==
+               grpc_compression_bitset_from_message_stream_compression_bitset(
+                   message_bitset | 1u, stream_bitset | 1u));
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -343,7 +461,9 @@ int main(int argc, char** argv) {
   test_compression_algorithm_for_level();
   test_compression_enable_disable_algorithm();
   test_channel_args_set_compression_algorithm();
+  test_channel_args_load_compression_dictionary();
   test_channel_args_compression_algorithm_states();
+  test_compression_bitset_conversion();
   grpc_shutdown();
   return 0;
 }
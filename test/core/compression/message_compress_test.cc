@@ -38,6 +38,12 @@ typedef enum {
   MAYBE_COMPRESSES
 } compressability;
 
+static bool is_available(grpc_message_compression_algorithm algorithm) {
+  return GPR_BITGET(grpc_compression_bitset_to_message_bitset(
+                        grpc_compression_algorithms_available_bitset()),
+                    algorithm) != 0;
+}
+
 static void assert_passthrough(grpc_slice value,
                                grpc_message_compression_algorithm algorithm,
                                grpc_slice_split_mode uncompressed_split_mode,
@@ -154,6 +160,9 @@ static void test_tiny_data_compress(void) {
 
   for (int i = 0; i < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; i++) {
     if (i == GRPC_MESSAGE_COMPRESS_NONE) continue;
+    if (!is_available(static_cast<grpc_message_compression_algorithm>(i))) {
+      continue;
+    }
     grpc_core::ExecCtx exec_ctx;
     GPR_ASSERT(0 == grpc_msg_compress(
 
@@ -224,6 +233,110 @@ static void test_bad_decompression_data_missing_trailer(void) {
   grpc_slice_buffer_destroy(&output);
 }
 
+static void test_bad_decompression_data_truncated(void) {
+  for (int i = 0; i < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; i++) {
+    const grpc_message_compression_algorithm algorithm =
+        static_cast<grpc_message_compression_algorithm>(i);
+    if (algorithm == GRPC_MESSAGE_COMPRESS_NONE || !is_available(algorithm)) {
+      continue;
+    }
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer garbage;
+    grpc_slice_buffer output;
+
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&garbage);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+
+    grpc_core::ExecCtx exec_ctx;
+    /* compress it */
+    GPR_ASSERT(grpc_msg_compress(algorithm, &input, &compressed));
+    GPR_ASSERT(compressed.length > 4);
+    /* chop off the end of the stream */
+    grpc_slice_buffer_trim_end(&compressed, 4, &garbage);
+    /* try (and fail) to decompress the truncated buffer */
+    GPR_ASSERT(0 == grpc_msg_decompress(algorithm, &compressed, &output));
+    GPR_ASSERT(0 == output.length);
+
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&garbage);
+    grpc_slice_buffer_destroy(&output);
+  }
+}
+
+static void test_dictionary_compress(void) {
+  const char kDictionary[] =
+      "{\"user\":\"alice\",\"region\":\"us-east\",\"status\":\"active\","
+      "\"metric\":\"latency\",\"unit\":\"milliseconds\"}";
+  const char kMessage[] =
+      "{\"user\":\"bob\",\"region\":\"us-east\",\"status\":\"active\","
+      "\"metric\":\"latency\",\"unit\":\"milliseconds\"}";
+  grpc_slice dictionary = grpc_slice_from_static_string(kDictionary);
+  grpc_slice other_dictionary =
+      grpc_slice_from_static_string("a different dictionary entirely");
+  GPR_ASSERT(grpc_msg_compression_dictionary_id(dictionary) !=
+             grpc_msg_compression_dictionary_id(other_dictionary));
+  GPR_ASSERT(!grpc_msg_compression_algorithm_supports_dictionary(
+      GRPC_MESSAGE_COMPRESS_GZIP));
+  for (int i = 0; i < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; i++) {
+    const grpc_message_compression_algorithm algorithm =
+        static_cast<grpc_message_compression_algorithm>(i);
+    if (!grpc_msg_compression_algorithm_supports_dictionary(algorithm) ||
+        !is_available(algorithm)) {
+      continue;
+    }
+    grpc_slice_buffer input;
+    grpc_slice_buffer plain;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&plain);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&input, grpc_slice_from_static_string(kMessage));
+
+    grpc_core::ExecCtx exec_ctx;
+    /* a small message only compresses well against the dictionary */
+    grpc_msg_compress(algorithm, &input, &plain);
+    GPR_ASSERT(grpc_msg_compress_with_dictionary(algorithm, dictionary, &input,
+                                                 &compressed));
+    GPR_ASSERT(compressed.length < plain.length);
+    GPR_ASSERT(compressed.length < input.length / 2);
+
+    /* without the dictionary, or with the wrong one, it cannot be read */
+    GPR_ASSERT(0 == grpc_msg_decompress(algorithm, &compressed, &output));
+    grpc_slice_buffer_reset_and_unref(&output);
+    GPR_ASSERT(0 == grpc_msg_decompress_with_dictionary(
+                        algorithm, other_dictionary, &compressed, &output));
+    grpc_slice_buffer_reset_and_unref(&output);
+
+    GPR_ASSERT(grpc_msg_decompress_with_dictionary(algorithm, dictionary,
+                                                   &compressed, &output));
+    grpc_slice final = grpc_slice_merge(output.slices, output.count);
+    GPR_ASSERT(grpc_slice_eq(final, input.slices[0]));
+    grpc_slice_unref(final);
+    grpc_slice_buffer_reset_and_unref(&output);
+
+    /* messages compressed without a dictionary still decompress with one */
+    grpc_slice_buffer_reset_and_unref(&plain);
+    grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+    GPR_ASSERT(grpc_msg_compress(algorithm, &input, &plain));
+    GPR_ASSERT(grpc_msg_decompress_with_dictionary(algorithm, dictionary,
+                                                   &plain, &output));
+    GPR_ASSERT(output.length == input.length);
+
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&plain);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+}
+
 static void test_bad_decompression_data_trailing_garbage(void) {
   grpc_slice_buffer input;
   grpc_slice_buffer output;
@@ -324,6 +437,10 @@ int main(int argc, char** argv) {
   grpc_init();
 
   for (i = 0; i < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; i++) {
+    if (!is_available(static_cast<grpc_message_compression_algorithm>(i))) {
+      gpr_log(GPR_INFO, "skipping algorithm %u: not built in", i);
+      continue;
+    }
     for (j = 0; j < GPR_ARRAY_SIZE(uncompressed_split_modes); j++) {
       for (k = 0; k < GPR_ARRAY_SIZE(compressed_split_modes); k++) {
         for (m = 0; m < TEST_VALUE_COUNT; m++) {
@@ -345,7 +462,9 @@ int main(int argc, char** argv) {
   test_bad_decompression_data_crc();
   test_bad_decompression_data_missing_trailer();
   test_bad_decompression_data_stream();
+  test_bad_decompression_data_truncated();
   test_bad_decompression_data_trailing_garbage();
+  test_dictionary_compress();
   test_bad_compression_algorithm();
   test_bad_decompression_algorithm();
   grpc_shutdown();
@@ -823,10 +823,245 @@ static void test_max_concurrent_streams_with_timeout_on_second(
   config.tear_down_data(&f);
 }
 
+static void test_max_concurrent_streams_with_extra_connections(
+    grpc_end2end_test_config config) {
+  grpc_end2end_test_fixture f;
+  grpc_arg server_arg;
+  grpc_arg client_arg;
+  grpc_channel_args server_args;
+  grpc_channel_args client_args;
+  grpc_call* c1;
+  grpc_call* c2;
+  grpc_call* s1;
+  grpc_call* s2;
+  gpr_timespec deadline;
+  cq_verifier* cqv;
+  grpc_call_details call_details1;
+  grpc_call_details call_details2;
+  grpc_metadata_array request_metadata_recv1;
+  grpc_metadata_array request_metadata_recv2;
+  grpc_metadata_array initial_metadata_recv1;
+  grpc_metadata_array trailing_metadata_recv1;
+  grpc_metadata_array initial_metadata_recv2;
+  grpc_metadata_array trailing_metadata_recv2;
+  grpc_status_code status1;
+  grpc_call_error error;
+  grpc_slice details1;
+  grpc_status_code status2;
+  grpc_slice details2;
+  grpc_op ops[6];
+  grpc_op* op;
+  int was_cancelled1;
+  int was_cancelled2;
+
+  server_arg.key = const_cast<char*>(GRPC_ARG_MAX_CONCURRENT_STREAMS);
+  server_arg.type = GRPC_ARG_INTEGER;
+  server_arg.value.integer = 1;
+
+  server_args.num_args = 1;
+  server_args.args = &server_arg;
+
+  /* The server's MAX_CONCURRENT_STREAMS caps the streams per connection, so
+     the second call needs an extra connection. */
+  client_arg.key = const_cast<char*>(GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS);
+  client_arg.type = GRPC_ARG_INTEGER;
+  client_arg.value.integer = 2;
+
+  client_args.num_args = 1;
+  client_args.args = &client_arg;
+
+  f = begin_test(config, "test_max_concurrent_streams_with_extra_connections",
+                 &client_args, &server_args);
+  cqv = cq_verifier_create(f.cq);
+
+  grpc_metadata_array_init(&request_metadata_recv1);
+  grpc_metadata_array_init(&request_metadata_recv2);
+  grpc_metadata_array_init(&initial_metadata_recv1);
+  grpc_metadata_array_init(&trailing_metadata_recv1);
+  grpc_metadata_array_init(&initial_metadata_recv2);
+  grpc_metadata_array_init(&trailing_metadata_recv2);
+  grpc_call_details_init(&call_details1);
+  grpc_call_details_init(&call_details2);
+
+  /* perform a ping-pong to ensure that settings have had a chance to round
+     trip */
+  simple_request_body(config, f);
+
+  /* start a first request and keep it open on the server */
+  deadline = n_seconds_from_now(1000);
+  c1 = grpc_channel_create_call(f.client, nullptr, GRPC_PROPAGATE_DEFAULTS,
+                                f.cq, grpc_slice_from_static_string("/alpha"),
+                                nullptr, deadline, nullptr);
+  GPR_ASSERT(c1);
+
+  GPR_ASSERT(GRPC_CALL_OK ==
+             grpc_server_request_call(f.server, &s1, &call_details1,
+                                      &request_metadata_recv1, f.cq, f.cq,
+                                      tag(101)));
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata =
+      &initial_metadata_recv1;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv1;
+  op->data.recv_status_on_client.status = &status1;
+  op->data.recv_status_on_client.status_details = &details1;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(c1, ops, static_cast<size_t>(op - ops),
+                                tag(301), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  CQ_EXPECT_COMPLETION(cqv, tag(101), 1);
+  cq_verify(cqv);
+
+  /* the first connection is now saturated: give the subchannel a moment to
+     bring up its extra connection */
+  cq_verify_empty_timeout(cqv, 1);
+
+  /* a second request must be accepted while the first is still live */
+  c2 = grpc_channel_create_call(f.client, nullptr, GRPC_PROPAGATE_DEFAULTS,
+                                f.cq, grpc_slice_from_static_string("/beta"),
+                                nullptr, deadline, nullptr);
+  GPR_ASSERT(c2);
+
+  GPR_ASSERT(GRPC_CALL_OK ==
+             grpc_server_request_call(f.server, &s2, &call_details2,
+                                      &request_metadata_recv2, f.cq, f.cq,
+                                      tag(201)));
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata =
+      &initial_metadata_recv2;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv2;
+  op->data.recv_status_on_client.status = &status2;
+  op->data.recv_status_on_client.status_details = &details2;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(c2, ops, static_cast<size_t>(op - ops),
+                                tag(401), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  CQ_EXPECT_COMPLETION(cqv, tag(201), 1);
+  cq_verify(cqv);
+
+  /* finish both calls */
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled1;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_UNIMPLEMENTED;
+  op->data.send_status_from_server.status_details = &status_details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(s1, ops, static_cast<size_t>(op - ops),
+                                tag(102), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled2;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_UNIMPLEMENTED;
+  op->data.send_status_from_server.status_details = &status_details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(s2, ops, static_cast<size_t>(op - ops),
+                                tag(202), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  CQ_EXPECT_COMPLETION(cqv, tag(102), 1);
+  CQ_EXPECT_COMPLETION(cqv, tag(202), 1);
+  CQ_EXPECT_COMPLETION(cqv, tag(301), 1);
+  CQ_EXPECT_COMPLETION(cqv, tag(401), 1);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status1 == GRPC_STATUS_UNIMPLEMENTED);
+  GPR_ASSERT(status2 == GRPC_STATUS_UNIMPLEMENTED);
+
+  cq_verifier_destroy(cqv);
+
+  grpc_call_unref(c1);
+  grpc_call_unref(s1);
+  grpc_call_unref(c2);
+  grpc_call_unref(s2);
+
+  grpc_slice_unref(details1);
+  grpc_slice_unref(details2);
+  grpc_metadata_array_destroy(&initial_metadata_recv1);
+  grpc_metadata_array_destroy(&trailing_metadata_recv1);
+  grpc_metadata_array_destroy(&initial_metadata_recv2);
+  grpc_metadata_array_destroy(&trailing_metadata_recv2);
+  grpc_metadata_array_destroy(&request_metadata_recv1);
+  grpc_metadata_array_destroy(&request_metadata_recv2);
+  grpc_call_details_destroy(&call_details1);
+  grpc_call_details_destroy(&call_details2);
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
 void max_concurrent_streams(grpc_end2end_test_config config) {
   test_max_concurrent_streams_with_timeout_on_first(config);
   test_max_concurrent_streams_with_timeout_on_second(config);
   test_max_concurrent_streams(config);
+  if (config.feature_mask & FEATURE_MASK_SUPPORTS_CLIENT_CHANNEL) {
+    test_max_concurrent_streams_with_extra_connections(config);
+  }
 }
 
 void max_concurrent_streams_pre_init(void) {}
@@ -35,6 +35,7 @@
 #include "test/core/util/test_config.h"
 
 using grpc_core::Arena;
+using grpc_core::ArenaPool;
 
 static void test_noop(void) { Arena::Create(1)->Destroy(); }
 
@@ -115,6 +116,46 @@ static void concurrent_test(void) {
   args.arena->Destroy();
 }
 
+static void test_pool_reuse(void) {
+  gpr_log(GPR_DEBUG, "test_pool_reuse");
+
+  ArenaPool pool(64 * 1024);
+  std::pair<Arena*, void*> a = pool.CreateWithAlloc(1024, 32);
+  GPR_ASSERT(a.first->Alloc(16) != a.second);
+  // Overflow the initial zone: the extra zone is freed on release.
+  memset(a.first->Alloc(4096), 1, 4096);
+  GPR_ASSERT(pool.Release(a.first) >= 32 + 16 + 4096);
+  // A similar size reuses the cached arena, with fresh accounting.
+  std::pair<Arena*, void*> b = pool.CreateWithAlloc(768, 64);
+  GPR_ASSERT(b.first == a.first);
+  GPR_ASSERT(b.second == a.second);
+  GPR_ASSERT(pool.Release(b.first) == 64);
+  // A larger size can't use it: it is dropped.
+  std::pair<Arena*, void*> c = pool.CreateWithAlloc(4096, 0);
+  memset(c.first->Alloc(4096), 1, 4096);
+  GPR_ASSERT(pool.Release(c.first) == 4096);
+  GPR_ASSERT(pool.Clear() > 4096);
+  GPR_ASSERT(pool.Clear() == 0);
+}
+
+static void test_pool_limit(void) {
+  gpr_log(GPR_DEBUG, "test_pool_limit");
+
+  ArenaPool pool(4096);
+  Arena* a = pool.CreateWithAlloc(3000, 0).first;
+  Arena* b = pool.CreateWithAlloc(3000, 0).first;
+  pool.Release(a);
+  // No room left for the second arena.
+  pool.Release(b);
+  size_t cached = pool.Clear();
+  GPR_ASSERT(cached > 3000);
+  GPR_ASSERT(cached <= 4096);
+  // An empty pool never caches anything.
+  ArenaPool empty_pool(0);
+  empty_pool.Release(empty_pool.CreateWithAlloc(1, 0).first);
+  GPR_ASSERT(empty_pool.Clear() == 0);
+}
+
 int main(int argc, char* argv[]) {
   grpc::testing::TestEnvironment env(argc, argv);
 
@@ -126,6 +167,8 @@ int main(int argc, char* argv[]) {
   TEST(1_inc, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11);
   TEST(6_123, 6, 1, 2, 3);
   concurrent_test();
+  test_pool_reuse();
+  test_pool_limit();
 
   return 0;
 }
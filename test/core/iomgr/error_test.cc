@@ -214,6 +214,39 @@ static void test_overflow() {
   ;
 }
 
+static void test_special_errors() {
+  intptr_t i;
+  grpc_slice str;
+
+  grpc_error* error = GRPC_ERROR_DEADLINE_EXCEEDED;
+  GPR_ASSERT(grpc_error_is_special(error));
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(i == GRPC_STATUS_DEADLINE_EXCEEDED);
+  GPR_ASSERT(!grpc_error_get_int(error, GRPC_ERROR_INT_HTTP2_ERROR, &i));
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_GRPC_MESSAGE, &str));
+  GPR_ASSERT(grpc_slice_str_cmp(str, "Deadline Exceeded") == 0);
+  GPR_ASSERT(strstr(grpc_error_string(error), "Deadline Exceeded"));
+
+  error = GRPC_ERROR_RST_STREAM_CANCEL;
+  GPR_ASSERT(grpc_error_is_special(error));
+  GPR_ASSERT(!grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_HTTP2_ERROR, &i));
+  GPR_ASSERT(i == 8);  // CANCEL
+
+  // Adding to a special error materializes it with the same contents.
+  error = grpc_error_set_int(error, GRPC_ERROR_INT_STREAM_ID, 1);
+  GPR_ASSERT(!grpc_error_is_special(error));
+  GPR_ASSERT(!grpc_error_get_int(error, GRPC_ERROR_INT_GRPC_STATUS, &i));
+  GPR_ASSERT(grpc_error_get_int(error, GRPC_ERROR_INT_HTTP2_ERROR, &i));
+  GPR_ASSERT(i == 8);
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_GRPC_MESSAGE, &str));
+  GPR_ASSERT(grpc_slice_str_cmp(str, "Received RST_STREAM with error code 8") ==
+             0);
+  GPR_ASSERT(grpc_error_get_str(error, GRPC_ERROR_STR_DESCRIPTION, &str));
+  GPR_ASSERT(grpc_slice_str_cmp(str, "RST_STREAM") == 0);
+  GRPC_ERROR_UNREF(error);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -226,6 +259,7 @@ int main(int argc, char** argv) {
   test_create_referencing();
   test_create_referencing_many();
   test_overflow();
+  test_special_errors();
   grpc_shutdown();
 
   return 0;
@@ -0,0 +1,241 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "src/core/lib/iomgr/port.h"
+
+/* This test only relevant on linux systems where epoll() is available */
+#if defined(GRPC_LINUX_EPOLL)
+#include "src/core/lib/iomgr/ev_epoll1_linux.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+#include "src/core/lib/iomgr/iomgr.h"
+#include "test/core/util/test_config.h"
+
+static gpr_mu* g_mu;
+static grpc_pollset* g_pollset;
+
+typedef struct {
+  bool done;
+  grpc_error* error;
+  grpc_closure closure;
+} ready_state;
+
+static void on_ready(void* arg, grpc_error* error) {
+  ready_state* state = static_cast<ready_state*>(arg);
+  gpr_mu_lock(g_mu);
+  state->done = true;
+  state->error = GRPC_ERROR_REF(error);
+  gpr_mu_unlock(g_mu);
+}
+
+static void ready_state_init(ready_state* state) {
+  state->done = false;
+  state->error = GRPC_ERROR_NONE;
+  GRPC_CLOSURE_INIT(&state->closure, on_ready, state,
+                    grpc_schedule_on_exec_ctx);
+}
+
+/* Polls until the closure of *state has run or the deadline passes, and
+   returns whether it ran */
+static bool poll_until_ready(ready_state* state, grpc_millis deadline) {
+  /* The closure may already be scheduled on this thread's exec_ctx */
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_mu_lock(g_mu);
+  while (!state->done && grpc_core::ExecCtx::Get()->Now() < deadline) {
+    grpc_pollset_worker* worker = nullptr;
+    GRPC_LOG_IF_ERROR("pollset_work",
+                      grpc_pollset_work(g_pollset, &worker, deadline));
+    gpr_mu_unlock(g_mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    grpc_core::ExecCtx::Get()->InvalidateNow();
+    gpr_mu_lock(g_mu);
+  }
+  bool done = state->done;
+  gpr_mu_unlock(g_mu);
+  return done;
+}
+
+static grpc_fd* create_socket_pair_fd(int* peer, const char* name) {
+  int sv[2];
+  GPR_ASSERT(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv) == 0);
+  *peer = sv[1];
+  grpc_fd* fd = grpc_fd_create(sv[0], name, false);
+  grpc_pollset_add_fd(g_pollset, fd);
+  return fd;
+}
+
+/* An fd reports writability right away, and readability only once the peer
+   has written. Readiness is reported again after the data was drained and
+   more arrives, which exercises the re-armed (multishot) poll. */
+static void test_fd_readiness() {
+  gpr_log(GPR_INFO, "test_fd_readiness");
+  grpc_core::ExecCtx exec_ctx;
+  int peer;
+  grpc_fd* fd = create_socket_pair_fd(&peer, "io_uring_test_readiness");
+  const grpc_millis deadline =
+      grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(10));
+
+  ready_state writable;
+  ready_state_init(&writable);
+  grpc_fd_notify_on_write(fd, &writable.closure);
+  GPR_ASSERT(poll_until_ready(&writable, deadline));
+  GPR_ASSERT(writable.error == GRPC_ERROR_NONE);
+
+  for (int i = 0; i < 3; i++) {
+    ready_state readable;
+    ready_state_init(&readable);
+    grpc_fd_notify_on_read(fd, &readable.closure);
+    GPR_ASSERT(!poll_until_ready(&readable,
+                                 grpc_core::ExecCtx::Get()->Now() + 100));
+    char byte = 'x';
+    GPR_ASSERT(write(peer, &byte, 1) == 1);
+    GPR_ASSERT(poll_until_ready(&readable, deadline));
+    GPR_ASSERT(readable.error == GRPC_ERROR_NONE);
+    GPR_ASSERT(read(grpc_fd_wrapped_fd(fd), &byte, 1) == 1);
+  }
+
+  grpc_fd_orphan(fd, nullptr, nullptr, "test_fd_readiness");
+  close(peer);
+}
+
+/* Shutting an fd down fails both the pending and any later read closure */
+static void test_fd_shutdown() {
+  gpr_log(GPR_INFO, "test_fd_shutdown");
+  grpc_core::ExecCtx exec_ctx;
+  int peer;
+  grpc_fd* fd = create_socket_pair_fd(&peer, "io_uring_test_shutdown");
+  const grpc_millis deadline =
+      grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(10));
+
+  ready_state pending;
+  ready_state_init(&pending);
+  grpc_fd_notify_on_read(fd, &pending.closure);
+  grpc_fd_shutdown(fd, GRPC_ERROR_CREATE_FROM_STATIC_STRING("test shutdown"));
+  GPR_ASSERT(grpc_fd_is_shutdown(fd));
+  GPR_ASSERT(poll_until_ready(&pending, deadline));
+  GPR_ASSERT(pending.error != GRPC_ERROR_NONE);
+  GRPC_ERROR_UNREF(pending.error);
+
+  ready_state later;
+  ready_state_init(&later);
+  grpc_fd_notify_on_read(fd, &later.closure);
+  GPR_ASSERT(poll_until_ready(&later, deadline));
+  GPR_ASSERT(later.error != GRPC_ERROR_NONE);
+  GRPC_ERROR_UNREF(later.error);
+
+  grpc_fd_orphan(fd, nullptr, nullptr, "test_fd_shutdown");
+  close(peer);
+}
+
+static void destroy_pollset(void* p, grpc_error* /*error*/) {
+  grpc_pollset_destroy(static_cast<grpc_pollset*>(p));
+}
+
+/* Runs the tests on the io_uring engine, which must have fallen back to epoll1
+   if \a expect_fallback */
+static void run_engine_tests(bool expect_fallback) {
+  GPR_GLOBAL_CONFIG_SET(grpc_poll_strategy, "io_uring");
+  grpc_init();
+  if (expect_fallback) {
+    GPR_ASSERT(!grpc_io_uring_linux_in_use());
+  } else if (!grpc_io_uring_linux_in_use()) {
+    gpr_log(GPR_INFO,
+            "io_uring is unavailable, testing the epoll1 fallback instead");
+  }
+  {
+    grpc_core::ExecCtx exec_ctx;
+    g_pollset = static_cast<grpc_pollset*>(gpr_zalloc(grpc_pollset_size()));
+    grpc_pollset_init(g_pollset, &g_mu);
+    test_fd_readiness();
+    test_fd_shutdown();
+    grpc_closure destroyed;
+    GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, g_pollset,
+                      grpc_schedule_on_exec_ctx);
+    grpc_pollset_shutdown(g_pollset, &destroyed);
+  }
+  grpc_shutdown();
+  gpr_free(g_pollset);
+}
+
+/* Makes io_uring_setup() fail with ENOSYS in this process, as it does on
+   kernels without io_uring. Returns false if seccomp is not available. */
+static bool disable_io_uring() {
+#ifdef __NR_io_uring_setup
+  struct sock_filter filter[] = {
+      BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(struct seccomp_data, nr)),
+      BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, __NR_io_uring_setup, 0, 1),
+      BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ERRNO | ENOSYS),
+      BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW),
+  };
+  struct sock_fprog prog = {
+      static_cast<unsigned short>(GPR_ARRAY_SIZE(filter)), filter};
+  return prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) == 0 &&
+         prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &prog) == 0;
+#else
+  errno = ENOSYS;
+  return false;
+#endif
+}
+
+/* In a child process where io_uring is unavailable, the engine falls back to
+   epoll1 and still works */
+static void test_fallback() {
+  gpr_log(GPR_INFO, "test_fallback");
+  pid_t pid = fork();
+  GPR_ASSERT(pid >= 0);
+  if (pid == 0) {
+    if (!disable_io_uring()) {
+      gpr_log(GPR_INFO, "seccomp unavailable (%s), skipping test_fallback",
+              strerror(errno));
+      _exit(0);
+    }
+    run_engine_tests(true);
+    _exit(0);
+  }
+  int status;
+  GPR_ASSERT(waitpid(pid, &status, 0) == pid);
+  GPR_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  /* Before this process initializes gRPC, so the child starts clean */
+  test_fallback();
+  run_engine_tests(false);
+  return 0;
+}
+#else /* defined(GRPC_LINUX_EPOLL) */
+int main(int /*argc*/, char** /*argv*/) { return 0; }
+#endif
@@ -513,9 +513,8 @@ static void destroy_pollset(void* p, grpc_error* /*error*/) {
   grpc_pollset_destroy(static_cast<grpc_pollset*>(p));
 }
 
-int main(int argc, char** argv) {
+static void run_tests(void) {
   grpc_closure destroyed;
-  grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
   {
     grpc_core::ExecCtx exec_ctx;
@@ -529,7 +528,16 @@ int main(int argc, char** argv) {
     grpc_core::ExecCtx::Get()->Flush();
     gpr_free(g_pollset);
   }
-  grpc_shutdown();
+  grpc_shutdown_blocking();
+}
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  run_tests();
+  /* Again with busy polling, which only epoll1 implements: other engines must
+     simply ignore it. */
+  GPR_GLOBAL_CONFIG_SET(grpc_poll_busy_poll_us, 100);
+  run_tests();
   return 0;
 }
 
@@ -250,8 +250,8 @@ static void read_test(size_t num_bytes, size_t slice_size) {
 }
 
 /* Write to a socket until it fills up, then read from it using the grpc_tcp
-   API. */
-static void large_read_test(size_t slice_size) {
+   API. With rx_zerocopy, reads go over TCP and map the received pages. */
+static void large_read_test(size_t slice_size, bool rx_zerocopy) {
   int sv[2];
   grpc_endpoint* ep;
   struct read_socket_state state;
@@ -260,14 +260,26 @@ static void large_read_test(size_t slice_size) {
       grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(20));
   grpc_core::ExecCtx exec_ctx;
 
-  gpr_log(GPR_INFO, "Start large read test, slice size %" PRIuPTR, slice_size);
+  gpr_log(GPR_INFO,
+          "Start large read test, slice size %" PRIuPTR ", rx zerocopy %d",
+          slice_size, rx_zerocopy);
 
-  create_sockets(sv);
+  if (rx_zerocopy) {
+    create_inet_sockets(sv);
+  } else {
+    create_sockets(sv);
+  }
 
-  grpc_arg a[1];
+  grpc_arg a[3];
   a[0].key = const_cast<char*>(GRPC_ARG_TCP_READ_CHUNK_SIZE);
   a[0].type = GRPC_ARG_INTEGER;
   a[0].value.integer = static_cast<int>(slice_size);
+  a[1].key = const_cast<char*>(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED);
+  a[1].type = GRPC_ARG_INTEGER;
+  a[1].value.integer = rx_zerocopy;
+  a[2].key = const_cast<char*>(GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD);
+  a[2].type = GRPC_ARG_INTEGER;
+  a[2].value.integer = 4096;
   grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
   ep = grpc_tcp_create(grpc_fd_create(sv[1], "large_read_test", false), &args,
                        "test");
@@ -565,8 +577,10 @@ void run_tests(void) {
   read_test(10000, 8192);
   read_test(10000, 137);
   read_test(10000, 1);
-  large_read_test(8192);
-  large_read_test(1);
+  large_read_test(8192, false);
+  large_read_test(1, false);
+  large_read_test(8192, true);
+  large_read_test(1024 * 1024, true);
 
   write_test(100, 8192, false);
   write_test(100, 1, false);
@@ -44,6 +44,7 @@
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/lib/iomgr/sockaddr_utils.h"
+#include "src/core/lib/iomgr/socket_utils_posix.h"
 #include "test/core/util/port.h"
 #include "test/core/util/test_config.h"
 
@@ -427,6 +428,115 @@ static void destroy_pollset(void* p, grpc_error* /*error*/) {
   grpc_pollset_destroy(static_cast<grpc_pollset*>(p));
 }
 
+static bool g_expect_affinity;
+static grpc_pollset* g_affinity_pollset;
+
+static void on_connect_affinity(void* arg, grpc_endpoint* tcp,
+                                grpc_pollset* pollset,
+                                grpc_tcp_server_acceptor* acceptor) {
+  const std::vector<grpc_pollset*>* pollsets =
+      static_cast<const std::vector<grpc_pollset*>*>(arg);
+  /* the connection must stay on the pollset polling the listener that
+     accepted it */
+  if (g_expect_affinity) {
+    GPR_ASSERT(acceptor->fd_index < pollsets->size());
+    GPR_ASSERT(pollset == (*pollsets)[acceptor->fd_index]);
+  }
+  g_affinity_pollset = pollset;
+  on_connect(nullptr, tcp, pollset, acceptor);
+}
+
+/* Tests that with GRPC_ARG_TCP_LISTENER_AFFINITY every pollset gets its own
+   listener and owns the connections accepted on it. */
+static void test_listener_affinity(void) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_resolved_address resolved_addr;
+  struct sockaddr_in* addr =
+      reinterpret_cast<struct sockaddr_in*>(resolved_addr.addr);
+  grpc_arg chan_args[2];
+  chan_args[0].type = GRPC_ARG_INTEGER;
+  chan_args[0].key = const_cast<char*>(GRPC_ARG_TCP_LISTENER_AFFINITY);
+  chan_args[0].value.integer = 1;
+  chan_args[1].type = GRPC_ARG_INTEGER;
+  chan_args[1].key = const_cast<char*>(GRPC_ARG_TCP_LISTENER_INCOMING_CPU);
+  chan_args[1].value.integer = 1;
+  const grpc_channel_args channel_args = {2, chan_args};
+  grpc_tcp_server* s;
+  GPR_ASSERT(GRPC_ERROR_NONE ==
+             grpc_tcp_server_create(nullptr, &channel_args, &s));
+  LOG_TEST("test_listener_affinity");
+  int port = -1;
+
+  memset(&resolved_addr, 0, sizeof(resolved_addr));
+  resolved_addr.len = static_cast<socklen_t>(sizeof(struct sockaddr_in));
+  addr->sin_family = AF_INET;
+  addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  GPR_ASSERT(grpc_tcp_server_add_port(s, &resolved_addr, &port) ==
+                 GRPC_ERROR_NONE &&
+             port > 0);
+
+  grpc_pollset* other_pollset =
+      static_cast<grpc_pollset*>(gpr_zalloc(grpc_pollset_size()));
+  gpr_mu* other_mu;
+  grpc_pollset_init(other_pollset, &other_mu);
+  std::vector<grpc_pollset*> pollsets;
+  pollsets.push_back(g_pollset);
+  pollsets.push_back(other_pollset);
+  grpc_tcp_server_start(s, &pollsets, on_connect_affinity, &pollsets);
+
+  /* without SO_REUSEPORT there is a single listener and no affinity */
+  const unsigned num_fds = grpc_tcp_server_port_fd_count(s, 0);
+  g_expect_affinity = grpc_is_socket_reuse_port_supported();
+  GPR_ASSERT(num_fds == (g_expect_affinity ? pollsets.size() : 1));
+
+  test_addr dst;
+  memcpy(&dst.addr, &resolved_addr, sizeof(dst.addr));
+  grpc_sockaddr_set_port(&dst.addr, port);
+  test_addr_init_str(&dst);
+  for (int i = 0; i < 10; i++) {
+    int clifd = socket(AF_INET, SOCK_STREAM, 0);
+    GPR_ASSERT(clifd >= 0);
+    gpr_mu_lock(g_mu);
+    const int nconnects_before = g_nconnects;
+    g_affinity_pollset = nullptr;
+    gpr_mu_unlock(g_mu);
+    GPR_ASSERT(connect(clifd,
+                       reinterpret_cast<const struct sockaddr*>(dst.addr.addr),
+                       static_cast<socklen_t>(dst.addr.len)) == 0);
+    /* poll both pollsets in turn until the connection has been accepted */
+    grpc_millis deadline =
+        grpc_timespec_to_millis_round_up(grpc_timeout_seconds_to_deadline(10));
+    for (size_t turn = 0;; turn++) {
+      grpc_pollset* pollset = pollsets[turn % pollsets.size()];
+      gpr_mu* mu = pollset == g_pollset ? g_mu : other_mu;
+      gpr_mu_lock(g_mu);
+      const bool done = g_nconnects != nconnects_before;
+      gpr_mu_unlock(g_mu);
+      if (done) break;
+      GPR_ASSERT(grpc_core::ExecCtx::Get()->Now() < deadline);
+      gpr_mu_lock(mu);
+      grpc_pollset_worker* worker = nullptr;
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "pollset_work",
+          grpc_pollset_work(pollset, &worker,
+                            grpc_core::ExecCtx::Get()->Now() + 10)));
+      gpr_mu_unlock(mu);
+    }
+    GPR_ASSERT(g_affinity_pollset != nullptr);
+    close(clifd);
+    grpc_tcp_server_unref(g_result.server);
+  }
+
+  grpc_tcp_server_unref(s);
+  grpc_core::ExecCtx::Get()->Flush();
+  grpc_closure destroyed;
+  GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, other_pollset,
+                    grpc_schedule_on_exec_ctx);
+  grpc_pollset_shutdown(other_pollset, &destroyed);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_free(other_pollset);
+}
+
 int main(int argc, char** argv) {
   grpc_closure destroyed;
   grpc_arg chan_args[1];
@@ -497,6 +607,8 @@ int main(int argc, char** argv) {
     /* Test connect(2) with dst_addrs. */
     test_connect(10, &channel_args, dst_addrs, false);
 
+    test_listener_affinity();
+
     GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, g_pollset,
                       grpc_schedule_on_exec_ctx);
     grpc_pollset_shutdown(g_pollset, &destroyed);
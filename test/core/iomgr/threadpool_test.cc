@@ -84,7 +84,8 @@ static void test_add(void) {
 // Thread that adds closures to pool
 class WorkThread {
  public:
-  WorkThread(grpc_core::ThreadPool* pool, SimpleFunctorForAdd* cb, int num_add)
+  WorkThread(grpc_core::ThreadPoolInterface* pool, SimpleFunctorForAdd* cb,
+             int num_add)
       : num_add_(num_add), cb_(cb), pool_(pool) {
     thd_ = grpc_core::Thread(
         "thread_pool_test_add_thd",
@@ -104,7 +105,7 @@ class WorkThread {
 
   int num_add_;
   SimpleFunctorForAdd* cb_;
-  grpc_core::ThreadPool* pool_;
+  grpc_core::ThreadPoolInterface* pool_;
   grpc_core::Thread thd_;
 };
 
@@ -179,6 +180,129 @@ static void test_one_thread_FIFO(void) {
   gpr_log(GPR_DEBUG, "Done.");
 }
 
+static void test_work_stealing_size_zero(void) {
+  gpr_log(GPR_INFO, "test_work_stealing_size_zero");
+  grpc_core::WorkStealingThreadPool* pool_size_zero =
+      new grpc_core::WorkStealingThreadPool(0);
+  GPR_ASSERT(pool_size_zero->pool_capacity() == 1);
+  delete pool_size_zero;
+}
+
+static void test_work_stealing_multi_add(void) {
+  gpr_log(GPR_INFO, "test_work_stealing_multi_add");
+  const int num_work_thds = 10;
+  grpc_core::WorkStealingThreadPool* pool =
+      new grpc_core::WorkStealingThreadPool(kSmallThreadPoolSize,
+                                            "test_work_stealing_multi_add");
+  SimpleFunctorForAdd* functor = new SimpleFunctorForAdd();
+  WorkThread** work_thds = static_cast<WorkThread**>(
+      gpr_zalloc(sizeof(WorkThread*) * num_work_thds));
+  for (int i = 0; i < num_work_thds; ++i) {
+    work_thds[i] = new WorkThread(pool, functor, kThreadLargeIter);
+    work_thds[i]->Start();
+  }
+  for (int i = 0; i < num_work_thds; ++i) {
+    work_thds[i]->Join();
+    delete work_thds[i];
+  }
+  gpr_free(work_thds);
+  // Destructor of thread pool will wait for all closures to finish
+  delete pool;
+  GPR_ASSERT(functor->count() == kThreadLargeIter * num_work_thds);
+  delete functor;
+  gpr_log(GPR_DEBUG, "Done.");
+}
+
+// Adds width children into the pool from a pool thread until depth reaches 0,
+// counting every run in *count. Exercises the per-worker deques and stealing.
+class FanOutFunctor : public grpc_experimental_completion_queue_functor {
+ public:
+  FanOutFunctor(grpc_core::ThreadPoolInterface* pool,
+                grpc_core::Atomic<int>* count, int depth, int width = 2)
+      : pool_(pool), count_(count), depth_(depth), width_(width) {
+    functor_run = &FanOutFunctor::Run;
+    inlineable = false;
+    internal_success = 0;
+  }
+  static void Run(struct grpc_experimental_completion_queue_functor* cb,
+                  int /*ok*/) {
+    auto* callback = static_cast<FanOutFunctor*>(cb);
+    callback->count_->FetchAdd(1, grpc_core::MemoryOrder::RELAXED);
+    if (callback->depth_ > 0) {
+      for (int i = 0; i < callback->width_; ++i) {
+        callback->pool_->Add(new FanOutFunctor(callback->pool_,
+                                               callback->count_,
+                                               callback->depth_ - 1,
+                                               callback->width_));
+      }
+    }
+    delete callback;
+  }
+
+ private:
+  grpc_core::ThreadPoolInterface* pool_;
+  grpc_core::Atomic<int>* count_;
+  int depth_;
+  int width_;
+};
+
+static void test_work_stealing_fan_out(void) {
+  gpr_log(GPR_INFO, "test_work_stealing_fan_out");
+  // Enough closures that workers keep stealing from each other.
+  const int kDepth = 12;
+  grpc_core::Atomic<int> count{0};
+  grpc_core::WorkStealingThreadPool* pool =
+      new grpc_core::WorkStealingThreadPool(kSmallThreadPoolSize,
+                                            "test_work_stealing_fan_out");
+  for (int i = 0; i < kThreadSmallIter; ++i) {
+    pool->Add(new FanOutFunctor(pool, &count, kDepth));
+  }
+  // Destructor of thread pool will wait for all closures to finish
+  delete pool;
+  GPR_ASSERT(count.Load(grpc_core::MemoryOrder::RELAXED) ==
+             kThreadSmallIter * ((2 << kDepth) - 1));
+  gpr_log(GPR_DEBUG, "Done.");
+}
+
+static void test_work_stealing_deque_overflow(void) {
+  gpr_log(GPR_INFO, "test_work_stealing_deque_overflow");
+  // A single closure adds more children than a worker deque holds (1024).
+  // With one thread nothing steals from the deque while it fills, so the
+  // rest have to go through the injection queue.
+  const int kWidth = 4096;
+  grpc_core::Atomic<int> count{0};
+  grpc_core::WorkStealingThreadPool* pool =
+      new grpc_core::WorkStealingThreadPool(
+          1, "test_work_stealing_deque_overflow");
+  pool->Add(new FanOutFunctor(pool, &count, 1, kWidth));
+  // Destructor of thread pool will wait for all closures to finish
+  delete pool;
+  GPR_ASSERT(count.Load(grpc_core::MemoryOrder::RELAXED) == kWidth + 1);
+  gpr_log(GPR_DEBUG, "Done.");
+}
+
+static void test_work_stealing_one_thread_FIFO(void) {
+  gpr_log(GPR_INFO, "test_work_stealing_one_thread_FIFO");
+  int counter = 0;
+  grpc_core::WorkStealingThreadPool* pool =
+      new grpc_core::WorkStealingThreadPool(
+          1, "test_work_stealing_one_thread_FIFO");
+  SimpleFunctorCheckForAdd** check_functors =
+      static_cast<SimpleFunctorCheckForAdd**>(
+          gpr_zalloc(sizeof(SimpleFunctorCheckForAdd*) * kThreadSmallIter));
+  // Closures added from outside the pool run in the order they were added.
+  for (int i = 0; i < kThreadSmallIter; ++i) {
+    check_functors[i] = new SimpleFunctorCheckForAdd(i + 1, &counter);
+    pool->Add(check_functors[i]);
+  }
+  delete pool;
+  for (int i = 0; i < kThreadSmallIter; ++i) {
+    delete check_functors[i];
+  }
+  gpr_free(check_functors);
+  gpr_log(GPR_DEBUG, "Done.");
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -187,6 +311,11 @@ int main(int argc, char** argv) {
   test_add();
   test_multi_add();
   test_one_thread_FIFO();
+  test_work_stealing_size_zero();
+  test_work_stealing_multi_add();
+  test_work_stealing_fan_out();
+  test_work_stealing_deque_overflow();
+  test_work_stealing_one_thread_FIFO();
   grpc_shutdown();
   return 0;
 }
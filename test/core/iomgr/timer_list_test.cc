@@ -18,7 +18,7 @@
 
 #include "src/core/lib/iomgr/port.h"
 
-// This test only works with the generic timer implementation
+// This test only works with the generic and timing wheel implementations
 #ifndef GRPC_CUSTOM_SOCKET
 
 #include "src/core/lib/iomgr/iomgr_internal.h"
@@ -219,41 +219,47 @@ void long_running_service_cleanup_test(void) {
 }
 
 int main(int argc, char** argv) {
-  /* Tests with default g_start_time */
-  {
-    grpc::testing::TestEnvironment env(argc, argv);
-    grpc_core::ExecCtx::GlobalInit();
-    grpc_core::ExecCtx exec_ctx;
-    grpc_determine_iomgr_platform();
-    grpc_iomgr_platform_init();
-    gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
-    add_test();
-    destruction_test();
-    grpc_iomgr_platform_shutdown();
+  for (const char* strategy : {"generic", "wheel"}) {
+    gpr_log(GPR_INFO, "timer strategy: %s", strategy);
+    GPR_GLOBAL_CONFIG_SET(grpc_timer_strategy, strategy);
+    /* Tests with default g_start_time */
+    {
+      grpc::testing::TestEnvironment env(argc, argv);
+      grpc_core::ExecCtx::GlobalInit();
+      grpc_core::ExecCtx exec_ctx;
+      grpc_determine_iomgr_platform();
+      grpc_set_default_timer_impl();
+      grpc_iomgr_platform_init();
+      gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
+      add_test();
+      destruction_test();
+      grpc_iomgr_platform_shutdown();
+    }
+    grpc_core::ExecCtx::GlobalShutdown();
+
+    /* Begin long running service tests */
+    {
+      grpc::testing::TestEnvironment env(argc, argv);
+      /* Set g_start_time back 25 days. */
+      /* We set g_start_time here in case there are any initialization
+          dependencies that use g_start_time. */
+      gpr_timespec new_start = gpr_time_sub(
+          gpr_now(gpr_clock_type::GPR_CLOCK_MONOTONIC),
+          gpr_time_from_hours(kHoursIn25Days,
+                              gpr_clock_type::GPR_CLOCK_MONOTONIC));
+      grpc_core::ExecCtx::TestOnlyGlobalInit(new_start);
+      grpc_core::ExecCtx exec_ctx;
+      grpc_determine_iomgr_platform();
+      grpc_set_default_timer_impl();
+      grpc_iomgr_platform_init();
+      gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
+      long_running_service_cleanup_test();
+      add_test();
+      destruction_test();
+      grpc_iomgr_platform_shutdown();
+    }
+    grpc_core::ExecCtx::GlobalShutdown();
   }
-  grpc_core::ExecCtx::GlobalShutdown();
-
-  /* Begin long running service tests */
-  {
-    grpc::testing::TestEnvironment env(argc, argv);
-    /* Set g_start_time back 25 days. */
-    /* We set g_start_time here in case there are any initialization
-        dependencies that use g_start_time. */
-    gpr_timespec new_start =
-        gpr_time_sub(gpr_now(gpr_clock_type::GPR_CLOCK_MONOTONIC),
-                     gpr_time_from_hours(kHoursIn25Days,
-                                         gpr_clock_type::GPR_CLOCK_MONOTONIC));
-    grpc_core::ExecCtx::TestOnlyGlobalInit(new_start);
-    grpc_core::ExecCtx exec_ctx;
-    grpc_determine_iomgr_platform();
-    grpc_iomgr_platform_init();
-    gpr_set_log_verbosity(GPR_LOG_SEVERITY_DEBUG);
-    long_running_service_cleanup_test();
-    add_test();
-    destruction_test();
-    grpc_iomgr_platform_shutdown();
-  }
-  grpc_core::ExecCtx::GlobalShutdown();
 
   return 0;
 }
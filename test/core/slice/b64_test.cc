@@ -200,6 +200,50 @@ static void test_unpadded_decode(void) {
   GPR_ASSERT(GRPC_SLICE_IS_EMPTY(decoded));
 }
 
+/* Inputs long enough to go through the vector kernels, checked against a
+   plain table lookup at every length, and with a bad char at every offset. */
+static void test_bulk_encode_decode_b64(int url_safe) {
+  const char* base64_chars =
+      url_safe
+          ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+          : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  unsigned char orig[300];
+  size_t i;
+  for (i = 0; i < sizeof(orig); i++) {
+    orig[i] = static_cast<uint8_t>(i * 7919 + 13);
+  }
+
+  grpc_core::ExecCtx exec_ctx;
+  for (size_t length = 0; length <= sizeof(orig); length++) {
+    char* b64 = grpc_base64_encode(orig, length, url_safe, 0);
+    for (i = 0; i + 3 <= length; i += 3) {
+      uint32_t packed = (static_cast<uint32_t>(orig[i]) << 16) |
+                        (static_cast<uint32_t>(orig[i + 1]) << 8) |
+                        orig[i + 2];
+      for (size_t j = 0; j < 4; j++) {
+        GPR_ASSERT(b64[i / 3 * 4 + j] ==
+                   base64_chars[(packed >> (18 - 6 * j)) & 0x3F]);
+      }
+    }
+    grpc_slice decoded = grpc_base64_decode(b64, url_safe);
+    GPR_ASSERT(GRPC_SLICE_LENGTH(decoded) == length);
+    GPR_ASSERT(buffers_are_equal(orig, GRPC_SLICE_START_PTR(decoded), length));
+    grpc_slice_unref_internal(decoded);
+    gpr_free(b64);
+  }
+
+  char* b64 = grpc_base64_encode(orig, sizeof(orig), url_safe, 0);
+  for (i = 0; b64[i] != '\0'; i++) {
+    const char saved = b64[i];
+    b64[i] = '*';
+    grpc_slice decoded = grpc_base64_decode(b64, url_safe);
+    GPR_ASSERT(GRPC_SLICE_IS_EMPTY(decoded));
+    grpc_slice_unref_internal(decoded);
+    b64[i] = saved;
+  }
+  gpr_free(b64);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -214,6 +258,8 @@ int main(int argc, char** argv) {
   test_url_safe_unsafe_mismatch_failure();
   test_rfc4648_test_vectors();
   test_unpadded_decode();
+  test_bulk_encode_decode_b64(0);
+  test_bulk_encode_decode_b64(1);
   grpc_shutdown();
   return 0;
 }
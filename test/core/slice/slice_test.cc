@@ -28,6 +28,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/transport/static_metadata.h"
 #include "test/core/util/test_config.h"
@@ -263,6 +264,53 @@ static void test_slice_interning(void) {
   grpc_shutdown();
 }
 
+#define NUM_INTERNING_THREADS 8
+#define NUM_INTERNED_NAMES 64
+
+static void interning_thread(void* arg) {
+  const grpc_slice* held = static_cast<const grpc_slice*>(arg);
+  for (int iter = 0; iter < 2000; iter++) {
+    for (int i = 0; i < NUM_INTERNED_NAMES; i++) {
+      // Even names are also held by the main thread and so must always map
+      // to the same interned slice; odd ones are created and destroyed over
+      // and over, growing and shrinking the table.
+      char name[32];
+      snprintf(name, sizeof(name), "threaded-intern-%d", i);
+      grpc_slice interned =
+          grpc_slice_intern(grpc_slice_from_static_string(name));
+      GPR_ASSERT(grpc_slice_str_cmp(interned, name) == 0);
+      if (i % 2 == 0) {
+        GPR_ASSERT(interned.refcount == held[i / 2].refcount);
+      }
+      grpc_slice_unref(interned);
+    }
+  }
+}
+
+static void test_slice_interning_threaded(void) {
+  LOG_TEST_NAME("test_slice_interning_threaded");
+
+  grpc_init();
+  grpc_slice held[NUM_INTERNED_NAMES / 2];
+  for (int i = 0; i < NUM_INTERNED_NAMES; i += 2) {
+    char name[32];
+    snprintf(name, sizeof(name), "threaded-intern-%d", i);
+    held[i / 2] = grpc_slice_intern(grpc_slice_from_static_string(name));
+  }
+  grpc_core::Thread threads[NUM_INTERNING_THREADS];
+  for (auto& th : threads) {
+    th = grpc_core::Thread("grpc_slice_intern_test", interning_thread, held);
+    th.Start();
+  }
+  for (auto& th : threads) {
+    th.Join();
+  }
+  for (grpc_slice& slice : held) {
+    grpc_slice_unref(slice);
+  }
+  grpc_shutdown();
+}
+
 static void test_static_slice_interning(void) {
   LOG_TEST_NAME("test_static_slice_interning");
 
@@ -352,6 +400,7 @@ int main(int argc, char** argv) {
   }
   test_slice_from_copied_string_works();
   test_slice_interning();
+  test_slice_interning_threaded();
   test_static_slice_interning();
   test_static_slice_copy_interning();
   test_moved_string_slice();
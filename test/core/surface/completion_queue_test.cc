@@ -165,6 +165,55 @@ static void test_cq_end_op(void) {
   }
 }
 
+/* queue more events than the lock-free ring holds so that some of them spill
+   into the unbounded queue, and make sure every one of them comes back */
+static void test_cq_next_ring(void) {
+  const size_t kNumEvents = 2500;
+  grpc_event ev;
+  grpc_completion_queue* cc;
+  grpc_cq_completion* completions = static_cast<grpc_cq_completion*>(
+      gpr_malloc(kNumEvents * sizeof(grpc_cq_completion)));
+  void** tags = static_cast<void**>(gpr_malloc(kNumEvents * sizeof(void*)));
+  bool* seen = static_cast<bool*>(gpr_zalloc(kNumEvents * sizeof(bool)));
+
+  LOG_TEST("test_cq_next_ring");
+
+  GPR_GLOBAL_CONFIG_SET(grpc_cq_next_ring, true);
+  cc = grpc_completion_queue_create_for_next(nullptr);
+  GPR_GLOBAL_CONFIG_SET(grpc_cq_next_ring, false);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    for (size_t i = 0; i < kNumEvents; i++) {
+      tags[i] = create_test_tag();
+      GPR_ASSERT(grpc_cq_begin_op(cc, tags[i]));
+      grpc_cq_end_op(cc, tags[i], GRPC_ERROR_NONE, do_nothing_end_completion,
+                     nullptr, &completions[i]);
+    }
+  }
+
+  for (size_t i = 0; i < kNumEvents; i++) {
+    ev = grpc_completion_queue_next(cc, gpr_inf_past(GPR_CLOCK_REALTIME),
+                                    nullptr);
+    GPR_ASSERT(ev.type == GRPC_OP_COMPLETE);
+    GPR_ASSERT(ev.success);
+    size_t j = static_cast<size_t>(reinterpret_cast<intptr_t>(ev.tag) -
+                                   reinterpret_cast<intptr_t>(tags[0]));
+    GPR_ASSERT(j < kNumEvents);
+    GPR_ASSERT(!seen[j]);
+    seen[j] = true;
+  }
+
+  ev = grpc_completion_queue_next(cc, gpr_inf_past(GPR_CLOCK_REALTIME),
+                                  nullptr);
+  GPR_ASSERT(ev.type == GRPC_QUEUE_TIMEOUT);
+
+  shutdown_and_destroy(cc);
+  gpr_free(seen);
+  gpr_free(tags);
+  gpr_free(completions);
+}
+
 static void test_cq_tls_cache_full(void) {
   grpc_event ev;
   grpc_completion_queue* cc;
@@ -495,6 +544,7 @@ int main(int argc, char** argv) {
   test_shutdown_then_next_polling();
   test_shutdown_then_next_with_timeout();
   test_cq_end_op();
+  test_cq_next_ring();
   test_pluck();
   test_pluck_after_shutdown();
   test_cq_tls_cache_full();
@@ -288,6 +288,77 @@ static void test_threading(size_t producers, size_t consumers) {
   gpr_free(options);
 }
 
+struct ring_producer_args {
+  grpc_completion_queue* cc;
+  grpc_cq_completion* completions;
+  size_t first;
+  size_t count;
+};
+
+static void ring_producer_thread(void* arg) {
+  ring_producer_args* args = static_cast<ring_producer_args*>(arg);
+  grpc_core::ExecCtx exec_ctx;
+  for (size_t i = args->first; i < args->first + args->count; i++) {
+    void* tag = reinterpret_cast<void*>(i + 1);
+    GPR_ASSERT(grpc_cq_begin_op(args->cc, tag));
+    grpc_cq_end_op(args->cc, tag, GRPC_ERROR_NONE, do_nothing_end_completion,
+                   nullptr, &args->completions[i]);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+}
+
+/* Overflow the lock-free ring, then keep producing while the queue is being
+   drained: the events that spilled out of the ring must all be delivered
+   before any event produced after them, instead of being starved by the
+   ring refilling. */
+static void test_ring_spill_under_load(void) {
+  /* Larger than the 1024 events the ring holds */
+  const size_t kQueued = 3000;
+  const size_t kProduced = 100000;
+  const size_t kTotal = kQueued + kProduced;
+  grpc_cq_completion* completions = static_cast<grpc_cq_completion*>(
+      gpr_malloc(kTotal * sizeof(grpc_cq_completion)));
+  bool* seen = static_cast<bool*>(gpr_zalloc(kTotal * sizeof(bool)));
+
+  LOG_TEST("test_ring_spill_under_load");
+
+  GPR_GLOBAL_CONFIG_SET(grpc_cq_next_ring, true);
+  grpc_completion_queue* cc = grpc_completion_queue_create_for_next(nullptr);
+  GPR_GLOBAL_CONFIG_SET(grpc_cq_next_ring, false);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    for (size_t i = 0; i < kQueued; i++) {
+      void* tag = reinterpret_cast<void*>(i + 1);
+      GPR_ASSERT(grpc_cq_begin_op(cc, tag));
+      grpc_cq_end_op(cc, tag, GRPC_ERROR_NONE, do_nothing_end_completion,
+                     nullptr, &completions[i]);
+    }
+  }
+
+  ring_producer_args args = {cc, completions, kQueued, kProduced};
+  grpc_core::Thread producer("grpc_ring_producer", ring_producer_thread,
+                             &args);
+  producer.Start();
+
+  for (size_t i = 0; i < kTotal; i++) {
+    grpc_event ev = grpc_completion_queue_next(cc, ten_seconds_time(), nullptr);
+    GPR_ASSERT(ev.type == GRPC_OP_COMPLETE);
+    size_t j = static_cast<size_t>(reinterpret_cast<intptr_t>(ev.tag)) - 1;
+    GPR_ASSERT(j < kTotal);
+    GPR_ASSERT(!seen[j]);
+    seen[j] = true;
+    if (i < kQueued) {
+      GPR_ASSERT(j < kQueued);
+    }
+  }
+
+  producer.Join();
+  shutdown_and_destroy(cc);
+  gpr_free(seen);
+  gpr_free(completions);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -296,6 +367,11 @@ int main(int argc, char** argv) {
   test_threading(1, 10);
   test_threading(10, 1);
   test_threading(10, 10);
+  GPR_GLOBAL_CONFIG_SET(grpc_cq_next_ring, true);
+  test_threading(1, 10);
+  test_threading(10, 10);
+  GPR_GLOBAL_CONFIG_SET(grpc_cq_next_ring, false);
+  test_ring_spill_under_load();
   grpc_shutdown();
   return 0;
 }
@@ -17,6 +17,7 @@
  */
 
 #include <string>
+#include <vector>
 
 #include "absl/strings/str_cat.h"
 
@@ -28,6 +29,7 @@
 #include "src/core/lib/gprpp/host_port.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/lib/security/credentials/fake/fake_credentials.h"
+#include "src/core/lib/surface/server.h"
 #include "test/core/util/port.h"
 #include "test/core/util/test_config.h"
 
@@ -58,6 +60,126 @@ void test_register_method_fail(void) {
   grpc_server_destroy(server);
 }
 
+static grpc_core::Server::RegisteredMethod* lookup(grpc_server* server,
+                                                   const char* host,
+                                                   const char* method,
+                                                   bool is_idempotent) {
+  return server->core_server->GetRegisteredMethod(
+      grpc_slice_from_static_string(host),
+      grpc_slice_from_static_string(method), is_idempotent);
+}
+
+static void start_server(grpc_server* server, grpc_completion_queue* cq) {
+  grpc_server_register_completion_queue(server, cq, nullptr);
+  grpc_server_start(server);
+}
+
+static void shutdown_server(grpc_server* server, grpc_completion_queue* cq) {
+  grpc_server_shutdown_and_notify(server, cq, nullptr);
+  grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_MONOTONIC), nullptr);
+  grpc_server_destroy(server);
+}
+
+/* a method registered for a host takes precedence over the same method
+   registered for any host, which serves every other host */
+void test_registered_method_host_precedence(void) {
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  void* on_host =
+      grpc_server_register_method(server, "/m", "h", GRPC_SRM_PAYLOAD_NONE, 0);
+  void* wildcard = grpc_server_register_method(server, "/m", nullptr,
+                                               GRPC_SRM_PAYLOAD_NONE, 0);
+  void* host_only = grpc_server_register_method(server, "/only_h", "h",
+                                                GRPC_SRM_PAYLOAD_NONE, 0);
+  GPR_ASSERT(on_host != nullptr && wildcard != nullptr &&
+             host_only != nullptr);
+  start_server(server, cq);
+  GPR_ASSERT(lookup(server, "h", "/m", false) == on_host);
+  GPR_ASSERT(lookup(server, "other", "/m", false) == wildcard);
+  GPR_ASSERT(lookup(server, "h", "/only_h", false) == host_only);
+  GPR_ASSERT(lookup(server, "other", "/only_h", false) == nullptr);
+  GPR_ASSERT(lookup(server, "h", "/unknown", false) == nullptr);
+  shutdown_server(server, cq);
+  grpc_completion_queue_destroy(cq);
+}
+
+/* a method registered as idempotent only matches idempotent requests; a
+   non-idempotent request falls back to the wildcard registration */
+void test_registered_method_idempotent(void) {
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  void* idempotent =
+      grpc_server_register_method(server, "/m", "h", GRPC_SRM_PAYLOAD_NONE,
+                                  GRPC_INITIAL_METADATA_IDEMPOTENT_REQUEST);
+  void* wildcard = grpc_server_register_method(server, "/m", nullptr,
+                                               GRPC_SRM_PAYLOAD_NONE, 0);
+  void* idempotent_only = grpc_server_register_method(
+      server, "/idempotent_only", nullptr, GRPC_SRM_PAYLOAD_NONE,
+      GRPC_INITIAL_METADATA_IDEMPOTENT_REQUEST);
+  start_server(server, cq);
+  GPR_ASSERT(lookup(server, "h", "/m", true) == idempotent);
+  GPR_ASSERT(lookup(server, "h", "/m", false) == wildcard);
+  GPR_ASSERT(lookup(server, "h", "/idempotent_only", true) == idempotent_only);
+  GPR_ASSERT(lookup(server, "h", "/idempotent_only", false) == nullptr);
+  shutdown_server(server, cq);
+  grpc_completion_queue_destroy(cq);
+}
+
+/* registers num_methods methods, each on host "h" and for any host, and
+   checks that every one of them is found */
+static void test_registered_method_table(size_t num_methods) {
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  std::vector<std::string> methods;
+  std::vector<void*> on_host;
+  std::vector<void*> wildcard;
+  for (size_t i = 0; i < num_methods; i++) {
+    methods.push_back(absl::StrCat("/service/method", i));
+  }
+  for (const std::string& method : methods) {
+    on_host.push_back(grpc_server_register_method(
+        server, method.c_str(), "h", GRPC_SRM_PAYLOAD_NONE, 0));
+    wildcard.push_back(grpc_server_register_method(
+        server, method.c_str(), nullptr, GRPC_SRM_PAYLOAD_NONE, 0));
+  }
+  start_server(server, cq);
+  for (size_t i = 0; i < num_methods; i++) {
+    GPR_ASSERT(lookup(server, "h", methods[i].c_str(), false) == on_host[i]);
+    GPR_ASSERT(lookup(server, "other", methods[i].c_str(), false) ==
+               wildcard[i]);
+  }
+  shutdown_server(server, cq);
+  grpc_completion_queue_destroy(cq);
+}
+
+/* methods whose bucket cannot be placed without collisions go to the
+   overflow list and are still found */
+void test_registered_method_overflow(void) {
+  /* no seed at all: every method overflows */
+  uint32_t max_seed =
+      grpc_core::Server::SetMaxRegisteredMethodSeedForTesting(0);
+  test_registered_method_table(20);
+  /* only seed 0: buckets that collide under it overflow, the rest are placed
+     in the table */
+  grpc_core::Server::SetMaxRegisteredMethodSeedForTesting(1);
+  test_registered_method_table(200);
+  grpc_core::Server::SetMaxRegisteredMethodSeedForTesting(max_seed);
+  test_registered_method_table(200);
+}
+
+void test_register_method_after_start(void) {
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  GPR_ASSERT(grpc_server_register_method(server, "/m", nullptr,
+                                         GRPC_SRM_PAYLOAD_NONE, 0) != nullptr);
+  start_server(server, cq);
+  GPR_ASSERT(grpc_server_register_method(server, "/late", nullptr,
+                                         GRPC_SRM_PAYLOAD_NONE, 0) == nullptr);
+  GPR_ASSERT(lookup(server, "h", "/late", false) == nullptr);
+  shutdown_server(server, cq);
+  grpc_completion_queue_destroy(cq);
+}
+
 void test_request_call_on_no_server_cq(void) {
   grpc_completion_queue* cc = grpc_completion_queue_create_for_next(nullptr);
   grpc_server* server = grpc_server_create(nullptr, nullptr);
@@ -152,6 +274,10 @@ int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
   test_register_method_fail();
+  test_registered_method_host_precedence();
+  test_registered_method_idempotent();
+  test_registered_method_overflow();
+  test_register_method_after_start();
   test_request_call_on_no_server_cq();
 #ifndef GRPC_UV
   test_bind_server_twice();
@@ -126,6 +126,20 @@ int main(int argc, char** argv) {
 
     EXPECT_SLICE_EQ("\xc0\xc1\xc2\xc3\xc4\xc5", base64_decode("wMHCw8TF"));
 
+    /* Inputs long enough to go through the bulk decoder */
+    ENCODE_AND_DECODE(
+        "The quick brown fox jumps over the lazy dog, then naps in the sun "
+        "for a while.");
+    EXPECT_SLICE_EQ(
+        "The quick brown fox jumps over the lazy dog, then naps in the sun "
+        "for a while",
+        base64_decode("VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IG"
+                      "RvZywgdGhlbiBuYXBzIGluIHRoZSBzdW4gZm9yIGEgd2hpbGU="));
+    EXPECT_SLICE_EQ(
+        "", base64_decode("VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVy:HRoZSBsYXp5"
+                          "IGRvZywgdGhlbiBuYXBzIGluIHRoZSBzdW4gZm9yIGEgd2hpbGU"
+                          "u"));
+
     // Test illegal input length in grpc_chttp2_base64_decode
     EXPECT_SLICE_EQ("", base64_decode("a"));
     EXPECT_SLICE_EQ("", base64_decode("ab"));
@@ -203,7 +203,8 @@ static void verify(const verify_params params, const char* expected,
       params.eof,                      /* is_eof */
       params.use_true_binary_metadata, /* use_true_binary_metadata */
       16384,                           /* max_frame_size */
-      &stats                           /* stats */
+      &stats,                          /* stats */
+      nullptr /* uncompressed_header_bytes */
   };
   grpc_chttp2_encode_header(&g_compressor, nullptr, 0, &b, &hopt, &output);
   verify_frames(output, params.eof);
@@ -276,7 +277,8 @@ static void verify_continuation_headers(const char* key, const char* value,
                                      is_eof,     /* is_eof */
                                      false,      /* use_true_binary_metadata */
                                      150,        /* max_frame_size */
-                                     &stats /* stats */};
+                                     &stats,     /* stats */
+                                     nullptr /* uncompressed_header_bytes */};
   grpc_chttp2_encode_header(&g_compressor, nullptr, 0, &b, &hopt, &output);
   verify_frames(output, is_eof);
   grpc_slice_buffer_destroy_internal(&output);
@@ -361,18 +363,21 @@ static void verify_table_size_change_match_elem_size(const char* key,
 
   grpc_transport_one_way_stats stats;
   stats = {};
+  uint64_t uncompressed_header_bytes = 0;
   grpc_encode_header_options hopt = {
-      0xdeadbeef,      /* stream_id */
-      false,           /* is_eof */
-      use_true_binary, /* use_true_binary_metadata */
-      16384,           /* max_frame_size */
-      &stats /* stats */};
+      0xdeadbeef,                 /* stream_id */
+      false,                      /* is_eof */
+      use_true_binary,            /* use_true_binary_metadata */
+      16384,                      /* max_frame_size */
+      &stats,                     /* stats */
+      &uncompressed_header_bytes /* uncompressed_header_bytes */};
   grpc_chttp2_encode_header(&g_compressor, nullptr, 0, &b, &hopt, &output);
   verify_frames(output, false);
   grpc_slice_buffer_destroy_internal(&output);
   grpc_metadata_batch_destroy(&b);
 
   GPR_ASSERT(g_compressor.table_size == elem_size + initial_table_size);
+  GPR_ASSERT(uncompressed_header_bytes == strlen(key) + strlen(value));
   gpr_free(e);
 }
 
@@ -394,6 +399,85 @@ static void test_interned_key_indexed() {
   }
 }
 
+static void encode_interned_header(const char* key, const char* value) {
+  grpc_slice_buffer output;
+  grpc_linked_mdelem e;
+  e.md = grpc_mdelem_from_slices(
+      grpc_slice_intern(grpc_slice_from_static_string(key)),
+      grpc_slice_intern(grpc_slice_from_static_string(value)));
+  e.prev = nullptr;
+  e.next = nullptr;
+  grpc_metadata_batch b;
+  grpc_metadata_batch_init(&b);
+  b.list.head = &e;
+  b.list.tail = &e;
+  b.list.count = 1;
+  grpc_slice_buffer_init(&output);
+
+  grpc_transport_one_way_stats stats;
+  stats = {};
+  grpc_encode_header_options hopt = {0xdeadbeef, /* stream_id */
+                                     false,      /* is_eof */
+                                     false,      /* use_true_binary_metadata */
+                                     16384,      /* max_frame_size */
+                                     &stats,     /* stats */
+                                     nullptr /* uncompressed_header_bytes */};
+  grpc_chttp2_encode_header(&g_compressor, nullptr, 0, &b, &hopt, &output);
+  verify_frames(output, false);
+  grpc_slice_buffer_destroy_internal(&output);
+  grpc_metadata_batch_destroy(&b);
+}
+
+static uint32_t interned_elem_hash(const char* key, const char* value) {
+  grpc_mdelem elem = grpc_mdelem_from_slices(
+      grpc_slice_intern(grpc_slice_from_static_string(key)),
+      grpc_slice_intern(grpc_slice_from_static_string(value)));
+  uint32_t hash =
+      reinterpret_cast<grpc_core::InternedMetadata*>(GRPC_MDELEM_DATA(elem))
+          ->hash();
+  GRPC_MDELEM_UNREF(elem);
+  return hash;
+}
+
+/* the filter cells of an elem hash, as picked in hpack_encoder.cc: row 0 uses
+   the lowest hash fragment, row 1 the fourth */
+static uint32_t filter_cell(uint32_t hash, int row) {
+  const int shift = row == 0 ? 0 : 3 * GRPC_CHTTP2_HPACKC_NUM_VALUES_BITS;
+  return (hash >> shift) & (GRPC_CHTTP2_HPACKC_NUM_VALUES - 1);
+}
+
+/* a header seen once must not be indexed just because it shares its row 0
+   filter cell with a popular header, which a single-row filter would do */
+static void test_colliding_rare_header_not_indexed() {
+  const uint32_t popular_hash = interned_elem_hash("popular", "value");
+  std::string rare_value;
+  for (int i = 0;; i++) {
+    GPR_ASSERT(i < 100000);
+    rare_value = absl::StrCat("rare-", i);
+    const uint32_t rare_hash = interned_elem_hash("rare", rare_value.c_str());
+    if (filter_cell(rare_hash, 0) == filter_cell(popular_hash, 0) &&
+        filter_cell(rare_hash, 1) != filter_cell(popular_hash, 1)) {
+      break;
+    }
+  }
+
+  for (int i = 0; i < 100; i++) {
+    encode_interned_header("popular", "value");
+  }
+  const uint32_t table_elems = g_compressor.table_elems;
+  GPR_ASSERT(table_elems == 1);
+
+  encode_interned_header("rare", rare_value.c_str());
+  /* the first row alone would have admitted it (the encoder admits cells
+     holding at least 2/GRPC_CHTTP2_HPACKC_NUM_VALUES of their row's sum)... */
+  const uint32_t cell = filter_cell(popular_hash, 0);
+  GPR_ASSERT(g_compressor.filter_elems[0][cell] >=
+             g_compressor.filter_elems_sum[0] /
+                 (GRPC_CHTTP2_HPACKC_NUM_VALUES >> 1));
+  /* ...but the second row keeps it out of the table */
+  GPR_ASSERT(g_compressor.table_elems == table_elems);
+}
+
 static void run_test(void (*test)(), const char* name) {
   gpr_log(GPR_INFO, "RUN TEST: %s", name);
   grpc_core::ExecCtx exec_ctx;
@@ -412,6 +496,7 @@ int main(int argc, char** argv) {
   TEST(test_encode_header_size);
   TEST(test_interned_key_indexed);
   TEST(test_continuation_headers);
+  TEST(test_colliding_rare_header_not_indexed);
   grpc_shutdown();
   for (i = 0; i < num_to_delete; i++) {
     gpr_free(to_delete[i]);
@@ -20,11 +20,17 @@
 
 #include <stdarg.h>
 
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_format.h"
+
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/util/parse_hexstring.h"
 #include "test/core/util/slice_splitter.h"
@@ -212,11 +218,53 @@ static void test_vectors(grpc_slice_split_mode mode) {
   grpc_chttp2_hpack_parser_destroy(&parser);
 }
 
+/* long huffman coded values: these decode through more than one batch of
+   output in the parser */
+static void test_huffman_round_trip(grpc_slice_split_mode mode) {
+  grpc_chttp2_hpack_parser parser;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_chttp2_hpack_parser_init(&parser);
+
+  for (size_t length : {1, 255, 256, 257, 1000, 4096}) {
+    std::string value;
+    for (size_t i = 0; i < length; i++) {
+      value.push_back(static_cast<char>(' ' + i % 95));
+    }
+    grpc_slice encoded = grpc_chttp2_huffman_compress(
+        grpc_slice_from_static_buffer(value.data(), value.size()));
+    /* literal header field without indexing, new name "a", huffman value */
+    std::vector<uint8_t> bytes = {0x00, 0x01, 'a'};
+    size_t encoded_length = GRPC_SLICE_LENGTH(encoded);
+    if (encoded_length < 0x7f) {
+      bytes.push_back(static_cast<uint8_t>(0x80 | encoded_length));
+    } else {
+      bytes.push_back(0xff);
+      for (encoded_length -= 0x7f; encoded_length >= 0x80;
+           encoded_length >>= 7) {
+        bytes.push_back(static_cast<uint8_t>(0x80 | (encoded_length & 0x7f)));
+      }
+      bytes.push_back(static_cast<uint8_t>(encoded_length));
+    }
+    std::string hex;
+    for (uint8_t b : bytes) hex += absl::StrFormat("%02x", b);
+    for (const uint8_t* p = GRPC_SLICE_START_PTR(encoded);
+         p != GRPC_SLICE_END_PTR(encoded); ++p) {
+      hex += absl::StrFormat("%02x", *p);
+    }
+    grpc_slice_unref(encoded);
+    test_vector(&parser, mode, hex.c_str(), "a", value.c_str(), NULL);
+  }
+
+  grpc_chttp2_hpack_parser_destroy(&parser);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
   test_vectors(GRPC_SLICE_SPLIT_MERGE_ALL);
   test_vectors(GRPC_SLICE_SPLIT_ONE_BYTE);
+  test_huffman_round_trip(GRPC_SLICE_SPLIT_MERGE_ALL);
+  test_huffman_round_trip(GRPC_SLICE_SPLIT_ONE_BYTE);
   grpc_shutdown();
   return 0;
 }
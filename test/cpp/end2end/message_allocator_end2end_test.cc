@@ -79,6 +79,30 @@ class CallbackTestServiceImpl
       allocator_mutator_;
 };
 
+class SyncTestServiceImpl : public EchoTestService::Service {
+ public:
+  void SetAllocatorMutator(
+      std::function<void(experimental::RpcAllocatorState* allocator_state,
+                         const EchoRequest* req, EchoResponse* resp)>
+          mutator) {
+    allocator_mutator_ = std::move(mutator);
+  }
+
+  Status Echo(ServerContext* context, const EchoRequest* request,
+              EchoResponse* response) override {
+    response->set_message(request->message());
+    if (allocator_mutator_) {
+      allocator_mutator_(context->GetRpcAllocatorState(), request, response);
+    }
+    return Status::OK;
+  }
+
+ private:
+  std::function<void(experimental::RpcAllocatorState* allocator_state,
+                     const EchoRequest* req, EchoResponse* resp)>
+      allocator_mutator_;
+};
+
 enum class Protocol { INPROC, TCP };
 
 class TestScenario {
@@ -112,6 +136,17 @@ class MessageAllocatorEnd2endTestBase
 
   void CreateServer(
       experimental::MessageAllocator<EchoRequest, EchoResponse>* allocator) {
+    callback_service_.SetMessageAllocatorFor_Echo(allocator);
+    CreateServerWithService(&callback_service_);
+  }
+
+  void CreateSyncServer(
+      experimental::MessageAllocator<EchoRequest, EchoResponse>* allocator) {
+    sync_service_.SetMessageAllocatorFor_Echo(allocator);
+    CreateServerWithService(&sync_service_);
+  }
+
+  void CreateServerWithService(Service* service) {
     ServerBuilder builder;
 
     auto server_creds = GetCredentialsProvider()->GetServerCredentials(
@@ -121,8 +156,7 @@ class MessageAllocatorEnd2endTestBase
       server_address_ << "localhost:" << picked_port_;
       builder.AddListeningPort(server_address_.str(), server_creds);
     }
-    callback_service_.SetMessageAllocatorFor_Echo(allocator);
-    builder.RegisterService(&callback_service_);
+    builder.RegisterService(service);
 
     server_ = builder.BuildAndStart();
   }
@@ -195,6 +229,7 @@ class MessageAllocatorEnd2endTestBase
   std::shared_ptr<Channel> channel_;
   std::unique_ptr<EchoTestService::Stub> stub_;
   CallbackTestServiceImpl callback_service_;
+  SyncTestServiceImpl sync_service_;
   std::unique_ptr<Server> server_;
   std::ostringstream server_address_;
 };
@@ -324,6 +359,41 @@ TEST_P(SimpleAllocatorTest, RpcWithReleaseRequest) {
   }
 }
 
+TEST_P(SimpleAllocatorTest, SyncRpc) {
+  const int kRpcCount = 10;
+  std::unique_ptr<SimpleAllocator> allocator(new SimpleAllocator);
+  CreateSyncServer(allocator.get());
+  ResetStub();
+  SendRpcs(kRpcCount);
+  // The sync handler releases the messages once the response has been sent.
+  DestroyServer();
+  EXPECT_EQ(kRpcCount, allocator->allocation_count);
+  EXPECT_EQ(kRpcCount, allocator->messages_deallocation_count);
+  EXPECT_EQ(0, allocator->request_deallocation_count);
+}
+
+TEST_P(SimpleAllocatorTest, SyncRpcWithEarlyFreeRequest) {
+  const int kRpcCount = 10;
+  std::unique_ptr<SimpleAllocator> allocator(new SimpleAllocator);
+  auto mutator = [](experimental::RpcAllocatorState* allocator_state,
+                    const EchoRequest* req, EchoResponse* resp) {
+    auto* info =
+        static_cast<SimpleAllocator::MessageHolderImpl*>(allocator_state);
+    EXPECT_EQ(req, info->request());
+    EXPECT_EQ(resp, info->response());
+    allocator_state->FreeRequest();
+    EXPECT_EQ(nullptr, info->request());
+  };
+  sync_service_.SetAllocatorMutator(mutator);
+  CreateSyncServer(allocator.get());
+  ResetStub();
+  SendRpcs(kRpcCount);
+  DestroyServer();
+  EXPECT_EQ(kRpcCount, allocator->allocation_count);
+  EXPECT_EQ(kRpcCount, allocator->messages_deallocation_count);
+  EXPECT_EQ(kRpcCount, allocator->request_deallocation_count);
+}
+
 class ArenaAllocatorTest : public MessageAllocatorEnd2endTestBase {
  public:
   class ArenaAllocator
@@ -362,6 +432,15 @@ TEST_P(ArenaAllocatorTest, SimpleRpc) {
   EXPECT_EQ(kRpcCount, allocator->allocation_count);
 }
 
+TEST_P(ArenaAllocatorTest, SyncRpc) {
+  const int kRpcCount = 10;
+  std::unique_ptr<ArenaAllocator> allocator(new ArenaAllocator);
+  CreateSyncServer(allocator.get());
+  ResetStub();
+  SendRpcs(kRpcCount);
+  EXPECT_EQ(kRpcCount, allocator->allocation_count);
+}
+
 std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
   std::vector<TestScenario> scenarios;
   std::vector<std::string> credentials_types{
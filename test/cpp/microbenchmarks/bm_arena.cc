@@ -25,6 +25,7 @@
 #include "test/cpp/util/test_config.h"
 
 using grpc_core::Arena;
+using grpc_core::ArenaPool;
 
 static void BM_Arena_NoOp(benchmark::State& state) {
   for (auto _ : state) {
@@ -60,6 +61,30 @@ static void BM_Arena_Batch(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_Batch)->Ranges({{1, 64 * 1024}, {1, 64}, {1, 1024}});
 
+static void BM_ArenaPool_NoOp(benchmark::State& state) {
+  TrackCounters track_counters;
+  ArenaPool pool(1024 * 1024);
+  for (auto _ : state) {
+    pool.Release(pool.CreateWithAlloc(state.range(0), 0).first);
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ArenaPool_NoOp)->Range(1, 1024 * 1024);
+
+static void BM_ArenaPool_Batch(benchmark::State& state) {
+  TrackCounters track_counters;
+  ArenaPool pool(1024 * 1024);
+  for (auto _ : state) {
+    Arena* a = pool.CreateWithAlloc(state.range(0), 0).first;
+    for (int i = 0; i < state.range(1); i++) {
+      a->Alloc(state.range(2));
+    }
+    pool.Release(a);
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ArenaPool_Batch)->Ranges({{1, 64 * 1024}, {1, 64}, {1, 1024}});
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -68,6 +93,7 @@ void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
 
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
   ::benchmark::Initialize(&argc, argv);
   ::grpc::testing::InitTest(&argc, &argv, false);
   benchmark::RunTheBenchmarksNamespaced();
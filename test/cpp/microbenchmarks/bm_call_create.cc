@@ -35,11 +35,13 @@
 #include "src/core/ext/filters/http/message_compress/message_compress_filter.h"
 #include "src/core/ext/filters/http/server/http_server_filter.h"
 #include "src/core/ext/filters/message_size/message_size_filter.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/connected_channel.h"
 #include "src/core/lib/iomgr/call_combiner.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/surface/channel.h"
+#include "src/core/lib/surface/server.h"
 #include "src/core/lib/transport/transport_impl.h"
 #include "src/cpp/client/create_channel_internal.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
@@ -92,6 +94,21 @@ class InsecureChannel : public BaseChannelFixture {
             grpc_insecure_channel_create("localhost:1234", nullptr, nullptr)) {}
 };
 
+// Calls on this channel reuse arenas, for comparison with InsecureChannel,
+// which allocates a new arena for each call.
+class InsecureChannelWithArenaPool : public BaseChannelFixture {
+ public:
+  InsecureChannelWithArenaPool() : BaseChannelFixture(CreateChannel()) {}
+
+ private:
+  static grpc_channel* CreateChannel() {
+    grpc_arg arg = grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_CALL_ARENA_POOL_SIZE), 128 * 1024);
+    grpc_channel_args args = {1, &arg};
+    return grpc_insecure_channel_create("localhost:1234", &args, nullptr);
+  }
+};
+
 class LameChannel : public BaseChannelFixture {
  public:
   LameChannel()
@@ -117,6 +134,7 @@ static void BM_CallCreateDestroy(benchmark::State& state) {
 }
 
 BENCHMARK_TEMPLATE(BM_CallCreateDestroy, InsecureChannel);
+BENCHMARK_TEMPLATE(BM_CallCreateDestroy, InsecureChannelWithArenaPool);
 BENCHMARK_TEMPLATE(BM_CallCreateDestroy, LameChannel);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -819,6 +837,53 @@ static void BM_IsolatedCall_StreamingSend(benchmark::State& state) {
 }
 BENCHMARK(BM_IsolatedCall_StreamingSend);
 
+// Server side dispatch of an incoming call to one of state.range(0) registered
+// methods. An interned path is what the HPACK parser produces for an indexed
+// :path.
+template <bool kInternedPath>
+static void BM_ServerRegisteredMethodLookup(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server_register_completion_queue(server, cq, nullptr);
+  std::vector<grpc_slice> paths;
+  for (int i = 0; i < state.range(0); i++) {
+    std::string method =
+        "/grpc.testing.EchoTestService/Method" + std::to_string(i);
+    GPR_ASSERT(grpc_server_register_method(server, method.c_str(), nullptr,
+                                           GRPC_SRM_PAYLOAD_NONE, 0));
+    grpc_slice path =
+        grpc_slice_from_copied_buffer(method.data(), method.size());
+    if (kInternedPath) {
+      grpc_slice interned = grpc_slice_intern(path);
+      grpc_slice_unref(path);
+      path = interned;
+    }
+    paths.push_back(path);
+  }
+  grpc_server_start(server);
+  grpc_slice host = grpc_slice_from_static_string("localhost");
+  size_t i = 0;
+  for (auto _ : state) {
+    GPR_ASSERT(server->core_server->GetRegisteredMethod(host, paths[i], false));
+    if (++i == paths.size()) i = 0;
+  }
+  for (const grpc_slice& path : paths) grpc_slice_unref(path);
+  grpc_server_shutdown_and_notify(server, cq, nullptr);
+  GPR_ASSERT(grpc_completion_queue_next(
+                 cq, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr)
+                 .type == GRPC_OP_COMPLETE);
+  grpc_server_destroy(server);
+  grpc_completion_queue_shutdown(cq);
+  GPR_ASSERT(grpc_completion_queue_next(
+                 cq, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr)
+                 .type == GRPC_QUEUE_SHUTDOWN);
+  grpc_completion_queue_destroy(cq);
+  track_counters.Finish(state);
+}
+BENCHMARK_TEMPLATE(BM_ServerRegisteredMethodLookup, true)->Range(1, 512);
+BENCHMARK_TEMPLATE(BM_ServerRegisteredMethodLookup, false)->Range(1, 512);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -25,6 +25,8 @@
 #include <memory>
 #include <sstream>
 
+#include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/ext/transport/chttp2/transport/incoming_metadata.h"
@@ -46,10 +48,90 @@ static grpc_slice MakeSlice(std::vector<uint8_t> bytes) {
   return s;
 }
 
+// Header values of the kind that are sent huffman compressed on most calls:
+// auth tokens, tracing contexts and client identification.
+static const std::pair<const char*, const char*> kHuffmanHeaders[] = {
+    {"authorization",
+     "Bearer eyJhbGciOiJSUzI1NiIsImtpZCI6IjFlOWdkazcifQ.eyJpc3MiOiJodHRwczov"
+     "L2FjY291bnRzLmV4YW1wbGUuY29tIiwic3ViIjoiMTEwMTY5NDg0NDc0Mzg2Mjc2MzM0Ii"
+     "wiYXVkIjoiZ3JwYy5leGFtcGxlLmNvbSIsImV4cCI6MTYxODQzMjM0NiwiaWF0IjoxNjE4"
+     "NDI4NzQ2fQ.cC4hiUPoj9Eetdgtv3hF80EGrhuB__dzERat0XF9g2VtQgr9PJbu3XOiZj5"},
+    {"traceparent", "00-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-01"},
+    {"x-cloud-trace-context", "105445aa7843bc8bf206b12000100000/1;o=1"},
+    {"x-request-id", "f058ebd6-02f7-4d3f-942e-904344e8cde5"},
+    {"user-agent", "grpc-c++/1.37.0 grpc-c/15.0.0 (linux; chttp2)"},
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // HPACK encoder
 //
 
+static void BM_HpackHuffmanCompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  std::vector<grpc_slice> values;
+  size_t bytes_per_iteration = 0;
+  for (const auto& header : kHuffmanHeaders) {
+    values.push_back(grpc_slice_from_static_string(header.second));
+    bytes_per_iteration += GRPC_SLICE_LENGTH(values.back());
+  }
+  for (auto _ : state) {
+    for (const grpc_slice& value : values) {
+      grpc_slice_unref(grpc_chttp2_huffman_compress(value));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * bytes_per_iteration);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_HpackHuffmanCompress);
+
+// Binary metadata of the given size, like serialized error details.
+static grpc_slice MakeBinaryValue(size_t length) {
+  grpc_slice value = grpc_slice_malloc(length);
+  for (size_t i = 0; i < length; i++) {
+    GRPC_SLICE_START_PTR(value)[i] = static_cast<uint8_t>(i * 7919 + 13);
+  }
+  return value;
+}
+
+static void BM_Base64Encode(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice value = MakeBinaryValue(state.range(0));
+  for (auto _ : state) {
+    grpc_slice_unref(grpc_chttp2_base64_encode(value));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref(value);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64Encode)->Range(16, 16384);
+
+static void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice value = MakeBinaryValue(state.range(0));
+  for (auto _ : state) {
+    grpc_slice_unref(grpc_chttp2_base64_encode_and_huffman_compress(value));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref(value);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress)->Range(16, 16384);
+
+static void BM_Base64Decode(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_slice value = MakeBinaryValue(state.range(0));
+  grpc_slice encoded = grpc_chttp2_base64_encode(value);
+  for (auto _ : state) {
+    grpc_slice_unref(grpc_chttp2_base64_decode_with_length(
+        encoded, GRPC_SLICE_LENGTH(value)));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  grpc_slice_unref(encoded);
+  grpc_slice_unref(value);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_Base64Decode)->Range(16, 16384);
+
 static void BM_HpackEncoderInitDestroy(benchmark::State& state) {
   TrackCounters track_counters;
   grpc_core::ExecCtx exec_ctx;
@@ -88,6 +170,7 @@ static void BM_HpackEncoderEncodeDeadline(benchmark::State& state) {
         false,
         static_cast<size_t>(1024),
         &stats,
+        nullptr,
     };
     grpc_chttp2_encode_header(c.get(), nullptr, 0, &b, &hopt, &outbuf);
     grpc_slice_buffer_reset_and_unref_internal(&outbuf);
@@ -139,6 +222,7 @@ static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
         Fixture::kEnableTrueBinary,
         static_cast<size_t>(state.range(1) + kEnsureMaxFrameAtLeast),
         &stats,
+        nullptr,
     };
     grpc_chttp2_encode_header(c.get(), nullptr, 0, &b, &hopt, &outbuf);
     if (!logged_representative_output && state.iterations() > 3) {
@@ -337,6 +421,81 @@ class RepresentativeServerTrailingMetadata {
   }
 };
 
+// Representative client initial metadata plus a custom header (think request
+// id) whose value is picked round robin from state.range(0) distinct values.
+// Values that are rarely repeated should not be indexed at the expense of the
+// popular ones, so header_bytes/iter should stay close to that of the fixed
+// metadata alone.
+static void BM_HpackEncoderEncodeWithDistinctCustomHeader(
+    benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+
+  std::vector<grpc_mdelem> elems =
+      RepresentativeClientInitialMetadata::GetElems();
+  std::vector<grpc_mdelem> custom_elems;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    custom_elems.push_back(grpc_mdelem_from_slices(
+        grpc_core::ManagedMemorySlice("x-request-id"),
+        grpc_core::ManagedMemorySlice(std::to_string(i).c_str())));
+  }
+  std::vector<grpc_linked_mdelem> storage(elems.size() + 1);
+
+  std::unique_ptr<grpc_chttp2_hpack_compressor> c(
+      new grpc_chttp2_hpack_compressor);
+  grpc_chttp2_hpack_compressor_init(c.get());
+  grpc_transport_one_way_stats stats;
+  stats = {};
+  uint64_t uncompressed_header_bytes = 0;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  size_t next_custom = 0;
+  while (state.KeepRunning()) {
+    grpc_metadata_batch b;
+    grpc_metadata_batch_init(&b);
+    for (size_t i = 0; i < elems.size(); i++) {
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "addmd", grpc_metadata_batch_add_tail(&b, &storage[i],
+                                                GRPC_MDELEM_REF(elems[i]))));
+    }
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "addmd",
+        grpc_metadata_batch_add_tail(
+            &b, &storage[elems.size()],
+            GRPC_MDELEM_REF(custom_elems[next_custom++ % custom_elems.size()]))));
+    grpc_encode_header_options hopt = {
+        static_cast<uint32_t>(state.iterations()),
+        false,
+        RepresentativeClientInitialMetadata::kEnableTrueBinary,
+        static_cast<size_t>(16384),
+        &stats,
+        &uncompressed_header_bytes,
+    };
+    grpc_chttp2_encode_header(c.get(), nullptr, 0, &b, &hopt, &outbuf);
+    grpc_metadata_batch_destroy(&b);
+    grpc_slice_buffer_reset_and_unref_internal(&outbuf);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  for (grpc_mdelem elem : elems) GRPC_MDELEM_UNREF(elem);
+  for (grpc_mdelem elem : custom_elems) GRPC_MDELEM_UNREF(elem);
+  grpc_chttp2_hpack_compressor_destroy(c.get());
+  grpc_slice_buffer_destroy_internal(&outbuf);
+
+  std::ostringstream label;
+  label << "header_bytes/iter:"
+        << (static_cast<double>(stats.header_bytes) /
+            static_cast<double>(state.iterations()))
+        << " compression_ratio:"
+        << (static_cast<double>(uncompressed_header_bytes) /
+            static_cast<double>(stats.header_bytes));
+  track_counters.AddLabel(label.str());
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_HpackEncoderEncodeWithDistinctCustomHeader)
+    ->Arg(1)
+    ->Arg(64)
+    ->Arg(4096);
+
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, EmptyBatch)->Args({0, 16384});
 // test with eof (shouldn't affect anything)
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, EmptyBatch)->Args({1, 16384});
@@ -865,6 +1024,63 @@ static grpc_error* OnHeaderTimeout(void* /*user_data*/, grpc_mdelem md) {
   return GRPC_ERROR_NONE;
 }
 
+// Appends an hpack string literal, with a 7 bit prefix length (RFC 7541 5.1).
+static void AppendStringLiteral(std::vector<uint8_t>* out, bool huffman,
+                                const grpc_slice& str) {
+  size_t length = GRPC_SLICE_LENGTH(str);
+  const uint8_t huffman_bit = huffman ? 0x80 : 0x00;
+  if (length < 0x7f) {
+    out->push_back(huffman_bit | static_cast<uint8_t>(length));
+  } else {
+    out->push_back(huffman_bit | 0x7f);
+    for (length -= 0x7f; length >= 0x80; length >>= 7) {
+      out->push_back(static_cast<uint8_t>(0x80 | (length & 0x7f)));
+    }
+    out->push_back(static_cast<uint8_t>(length));
+  }
+  out->insert(out->end(), GRPC_SLICE_START_PTR(str), GRPC_SLICE_END_PTR(str));
+}
+
+// Literal headers with new names, not indexed, with huffman compressed values.
+class HuffmanEncodedValues {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> v;
+    for (const auto& header : kHuffmanHeaders) {
+      v.push_back(0x00);
+      AppendStringLiteral(&v, false,
+                          grpc_slice_from_static_string(header.first));
+      grpc_slice value = grpc_chttp2_huffman_compress(
+          grpc_slice_from_static_string(header.second));
+      AppendStringLiteral(&v, true, value);
+      grpc_slice_unref(value);
+    }
+    return {MakeSlice(v)};
+  }
+};
+
+// As above, with huffman compressed names too.
+class HuffmanEncodedNamesAndValues {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> v;
+    for (const auto& header : kHuffmanHeaders) {
+      v.push_back(0x00);
+      grpc_slice name = grpc_chttp2_huffman_compress(
+          grpc_slice_from_static_string(header.first));
+      AppendStringLiteral(&v, true, name);
+      grpc_slice_unref(name);
+      grpc_slice value = grpc_chttp2_huffman_compress(
+          grpc_slice_from_static_string(header.second));
+      AppendStringLiteral(&v, true, value);
+      grpc_slice_unref(value);
+    }
+    return {MakeSlice(v)};
+  }
+};
+
 // Send the same deadline repeatedly
 class SameDeadline {
  public:
@@ -928,6 +1144,10 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata, OnInitialHeader);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline, OnHeaderTimeout);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, HuffmanEncodedValues,
+                   UnrefHeader);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, HuffmanEncodedNamesAndValues,
+                   UnrefHeader);
 
 }  // namespace hpack_parser_fixtures
 
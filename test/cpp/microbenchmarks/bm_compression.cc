@@ -0,0 +1,152 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark message compression and decompression throughput */
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <string.h>
+
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
+
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+// Something that looks like a serialized protobuf: a handful of repeated
+// fields with small varints, short strings and a few random bytes.
+static grpc_slice MakePayload(size_t length) {
+  static const char* const kWords[] = {"user",    "account", "region",
+                                       "us-east", "status",  "active",
+                                       "metric",  "latency"};
+  grpc_slice payload = GRPC_SLICE_MALLOC(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(payload);
+  uint32_t rnd = 12345;
+  for (size_t i = 0; i < length;) {
+    rnd = rnd * 1103515245 + 12345;
+    const char* word = kWords[(rnd >> 16) % GPR_ARRAY_SIZE(kWords)];
+    const size_t word_len = strlen(word);
+    uint8_t field[32];
+    size_t n = 0;
+    field[n++] = static_cast<uint8_t>(((rnd >> 8) & 0xf) << 3 | 2);
+    field[n++] = static_cast<uint8_t>(word_len);
+    memcpy(field + n, word, word_len);
+    n += word_len;
+    field[n++] = 0x10;
+    field[n++] = static_cast<uint8_t>(rnd >> 24);
+    n = GPR_MIN(n, length - i);
+    memcpy(p + i, field, n);
+    i += n;
+  }
+  return payload;
+}
+
+static bool IsAvailable(grpc_message_compression_algorithm algorithm) {
+  return GPR_BITGET(grpc_compression_bitset_to_message_bitset(
+                        grpc_compression_algorithms_available_bitset()),
+                    algorithm) != 0;
+}
+
+template <grpc_message_compression_algorithm kAlgorithm>
+static void BM_MessageCompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  if (!IsAvailable(kAlgorithm)) {
+    state.SkipWithError("compression algorithm not built in");
+    return;
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, MakePayload(state.range(0)));
+  size_t compressed_length = 0;
+  for (auto _ : state) {
+    grpc_msg_compress(kAlgorithm, &input, &output);
+    compressed_length = output.length;
+    grpc_slice_buffer_reset_and_unref_internal(&output);
+  }
+  state.SetBytesProcessed(state.iterations() * input.length);
+  state.counters["ratio"] =
+      static_cast<double>(input.length) / compressed_length;
+  grpc_slice_buffer_destroy_internal(&input);
+  grpc_slice_buffer_destroy_internal(&output);
+  track_counters.Finish(state);
+}
+BENCHMARK_TEMPLATE(BM_MessageCompress, GRPC_MESSAGE_COMPRESS_GZIP)
+    ->Range(64, 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_MessageCompress, GRPC_MESSAGE_COMPRESS_ZSTD)
+    ->Range(64, 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_MessageCompress, GRPC_MESSAGE_COMPRESS_LZ4)
+    ->Range(64, 1024 * 1024);
+
+template <grpc_message_compression_algorithm kAlgorithm>
+static void BM_MessageDecompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  if (!IsAvailable(kAlgorithm)) {
+    state.SkipWithError("compression algorithm not built in");
+    return;
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, MakePayload(state.range(0)));
+  const grpc_message_compression_algorithm algorithm =
+      grpc_msg_compress(kAlgorithm, &input, &compressed)
+          ? kAlgorithm
+          : GRPC_MESSAGE_COMPRESS_NONE;
+  for (auto _ : state) {
+    GPR_ASSERT(grpc_msg_decompress(algorithm, &compressed, &output));
+    grpc_slice_buffer_reset_and_unref_internal(&output);
+  }
+  state.SetBytesProcessed(state.iterations() * input.length);
+  grpc_slice_buffer_destroy_internal(&input);
+  grpc_slice_buffer_destroy_internal(&compressed);
+  grpc_slice_buffer_destroy_internal(&output);
+  track_counters.Finish(state);
+}
+BENCHMARK_TEMPLATE(BM_MessageDecompress, GRPC_MESSAGE_COMPRESS_GZIP)
+    ->Range(64, 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_MessageDecompress, GRPC_MESSAGE_COMPRESS_ZSTD)
+    ->Range(64, 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_MessageDecompress, GRPC_MESSAGE_COMPRESS_LZ4)
+    ->Range(64, 1024 * 1024);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -106,7 +106,7 @@ static const grpc_event_engine_vtable* init_engine_vtable(bool) {
   return &g_vtable;
 }
 
-static void setup() {
+static void setup(bool use_ring) {
   // This test should only ever be run with a non or any polling engine
   // Override the polling engine for the non-polling engine
   // and add a custom polling engine
@@ -119,7 +119,9 @@ static void setup() {
              strcmp(grpc_get_poll_strategy_name(), "bm_cq_multiple_threads") ==
                  0);
 
+  GPR_GLOBAL_CONFIG_SET(grpc_cq_next_ring, use_ring);
   g_cq = grpc_completion_queue_create_for_next(nullptr);
+  GPR_GLOBAL_CONFIG_SET(grpc_cq_next_ring, false);
 }
 
 static void teardown() {
@@ -156,14 +158,12 @@ static void teardown() {
  and its Finish call must take place before grpc_shutdown so that it can use
  grpc_stats).
 */
-static void BM_Cq_Throughput(benchmark::State& state) {
+static void start_threads(benchmark::State& state) {
   gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
-  auto thd_idx = state.thread_index;
-
   gpr_mu_lock(&g_mu);
   g_threads_active++;
-  if (thd_idx == 0) {
-    setup();
+  if (state.thread_index == 0) {
+    setup(state.range(0) != 0);
     g_active = true;
     gpr_cv_broadcast(&g_cv);
   } else {
@@ -172,6 +172,31 @@ static void BM_Cq_Throughput(benchmark::State& state) {
     }
   }
   gpr_mu_unlock(&g_mu);
+}
+
+static void stop_threads(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  gpr_mu_lock(&g_mu);
+  g_threads_active--;
+  if (g_threads_active == 0) {
+    gpr_cv_broadcast(&g_cv);
+  } else {
+    while (g_threads_active > 0) {
+      gpr_cv_wait(&g_cv, &g_mu, deadline);
+    }
+  }
+  gpr_mu_unlock(&g_mu);
+
+  if (state.thread_index == 0) {
+    teardown();
+    g_active = false;
+  }
+}
+
+/* Arg 0 selects the default queue, arg 1 the lock-free ring */
+static void BM_Cq_Throughput(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  start_threads(state);
 
   // Use a TrackCounters object to monitor the gRPC performance statistics
   // (optionally including low-level counters) before and after the test
@@ -184,25 +209,47 @@ static void BM_Cq_Throughput(benchmark::State& state) {
 
   state.SetItemsProcessed(state.iterations());
   track_counters.Finish(state);
+  stop_threads(state);
+}
 
-  gpr_mu_lock(&g_mu);
-  g_threads_active--;
-  if (g_threads_active == 0) {
-    gpr_cv_broadcast(&g_cv);
-  } else {
-    while (g_threads_active > 0) {
-      gpr_cv_wait(&g_cv, &g_mu, deadline);
+BENCHMARK(BM_Cq_Throughput)
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+/* Every thread both queues and dequeues completions, so with more than one
+   thread events are usually already waiting and consumers contend on the
+   queue itself rather than on the pollset. Arg as for BM_Cq_Throughput. */
+static void BM_Cq_QueuedThroughput(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  start_threads(state);
+
+  TrackCounters track_counters;
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    void* tag = reinterpret_cast<void*>(20);  // Some random number
+    for (auto _ : state) {
+      GPR_ASSERT(grpc_cq_begin_op(g_cq, tag));
+      grpc_cq_end_op(g_cq, tag, GRPC_ERROR_NONE, cq_done_cb, nullptr,
+                     static_cast<grpc_cq_completion*>(
+                         gpr_malloc(sizeof(grpc_cq_completion))));
+      GPR_ASSERT(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
+                 GRPC_OP_COMPLETE);
     }
   }
-  gpr_mu_unlock(&g_mu);
 
-  if (thd_idx == 0) {
-    teardown();
-    g_active = false;
-  }
+  state.SetItemsProcessed(state.iterations());
+  track_counters.Finish(state);
+  stop_threads(state);
 }
 
-BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_Cq_QueuedThroughput)
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
 
 }  // namespace testing
 }  // namespace grpc
@@ -63,6 +63,30 @@ static void BM_ErrorCreateAndSetStatus(benchmark::State& state) {
 }
 BENCHMARK(BM_ErrorCreateAndSetStatus);
 
+// What a deadline expiry cost before it became a special error; compare with
+// BM_ErrorCreateDeadlineExceeded below.
+static void BM_ErrorCreateHeapDeadlineExceeded(benchmark::State& state) {
+  TrackCounters track_counters;
+  for (auto _ : state) {
+    GRPC_ERROR_UNREF(grpc_error_set_int(
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING("Deadline Exceeded"),
+        GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_DEADLINE_EXCEEDED));
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ErrorCreateHeapDeadlineExceeded);
+
+static void BM_ErrorCreateDeadlineExceeded(benchmark::State& state) {
+  TrackCounters track_counters;
+  for (auto _ : state) {
+    grpc_error* error = GRPC_ERROR_DEADLINE_EXCEEDED;
+    benchmark::DoNotOptimize(error);
+    GRPC_ERROR_UNREF(error);
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ErrorCreateDeadlineExceeded);
+
 static void BM_ErrorCreateAndSetIntAndStr(benchmark::State& state) {
   TrackCounters track_counters;
   for (auto _ : state) {
@@ -173,6 +197,24 @@ class ErrorCancelled {
   const grpc_millis deadline_ = GRPC_MILLIS_INF_FUTURE;
 };
 
+class ErrorDeadlineExceeded {
+ public:
+  grpc_millis deadline() const { return deadline_; }
+  grpc_error* error() const { return GRPC_ERROR_DEADLINE_EXCEEDED; }
+
+ private:
+  const grpc_millis deadline_ = GRPC_MILLIS_INF_FUTURE;
+};
+
+class ErrorRstStreamCancel {
+ public:
+  grpc_millis deadline() const { return deadline_; }
+  grpc_error* error() const { return GRPC_ERROR_RST_STREAM_CANCEL; }
+
+ private:
+  const grpc_millis deadline_ = GRPC_MILLIS_INF_FUTURE;
+};
+
 class SimpleError {
  public:
   grpc_millis deadline() const { return deadline_; }
@@ -305,6 +347,8 @@ static void BM_HasClearGrpcStatus(benchmark::State& state) {
 
 BENCHMARK_SUITE(ErrorNone);
 BENCHMARK_SUITE(ErrorCancelled);
+BENCHMARK_SUITE(ErrorDeadlineExceeded);
+BENCHMARK_SUITE(ErrorRstStreamCancel);
 BENCHMARK_SUITE(SimpleError);
 BENCHMARK_SUITE(ErrorWithGrpcStatus);
 BENCHMARK_SUITE(ErrorWithHttpError);
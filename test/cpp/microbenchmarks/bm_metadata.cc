@@ -21,6 +21,11 @@
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
 
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/transport/metadata.h"
 #include "src/core/lib/transport/static_metadata.h"
@@ -69,6 +74,51 @@ static void BM_SliceReIntern(benchmark::State& state) {
 }
 BENCHMARK(BM_SliceReIntern);
 
+// Header names seen by every thread, such as custom metadata keys that all
+// calls on a server carry.
+static const char* const kSharedHeaderNames[] = {
+    "x-request-id",   "x-trace-id",      "x-span-id",      "x-user-id",
+    "x-tenant-id",    "x-shard-key",     "x-session-id",   "x-client-id",
+    "x-api-version",  "x-region",        "x-zone",         "x-deadline-ms",
+    "x-retry-count",  "x-feature-flags", "x-experiment",   "x-origin",
+};
+
+static void BM_SliceInternThreaded(benchmark::State& state) {
+  // The names stay interned throughout, so every iteration is a lookup of an
+  // existing entry racing with the other threads' lookups.
+  std::vector<grpc_slice> held;
+  for (const char* name : kSharedHeaderNames) {
+    held.push_back(grpc_slice_intern(grpc_slice_from_static_string(name)));
+  }
+  TrackCounters track_counters;
+  size_t i = state.thread_index;
+  for (auto _ : state) {
+    grpc_slice_unref(grpc_core::ManagedMemorySlice(
+        kSharedHeaderNames[i++ % GPR_ARRAY_SIZE(kSharedHeaderNames)]));
+  }
+  track_counters.Finish(state);
+  for (grpc_slice& slice : held) grpc_slice_unref(slice);
+}
+BENCHMARK(BM_SliceInternThreaded)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_SliceInternUninternThreaded(benchmark::State& state) {
+  // Every thread interns names of its own and releases them again, so each
+  // iteration inserts into and removes from the intern table.
+  std::vector<std::string> names;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(kSharedHeaderNames); i++) {
+    names.push_back(absl::StrCat(kSharedHeaderNames[i], "-",
+                                 state.thread_index));
+  }
+  TrackCounters track_counters;
+  size_t i = 0;
+  for (auto _ : state) {
+    const std::string& name = names[i++ % names.size()];
+    grpc_slice_unref(grpc_core::ManagedMemorySlice(name.data(), name.size()));
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SliceInternUninternThreaded)->ThreadRange(1, 64)->UseRealTime();
+
 static void BM_SliceInternStaticMetadata(benchmark::State& state) {
   TrackCounters track_counters;
   for (auto _ : state) {
@@ -134,6 +184,31 @@ static void BM_MetadataFromInternedSlicesAlreadyInIndex(
 }
 BENCHMARK(BM_MetadataFromInternedSlicesAlreadyInIndex);
 
+static void BM_MetadataFromInternedSlicesThreaded(benchmark::State& state) {
+  // Every thread repeatedly creates the same handful of interned elements, as
+  // the hpack parser does for hot headers on a busy server.
+  std::vector<grpc_slice> keys;
+  std::vector<grpc_slice> values;
+  for (size_t i = 0; i < 4; i++) {
+    keys.push_back(grpc_slice_intern(
+        grpc_slice_from_static_string(kSharedHeaderNames[i])));
+    values.push_back(grpc_slice_intern(grpc_slice_from_static_string("value")));
+  }
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  size_t i = state.thread_index;
+  for (auto _ : state) {
+    size_t idx = i++ % keys.size();
+    GRPC_MDELEM_UNREF(grpc_mdelem_create(keys[idx], values[idx], nullptr));
+  }
+  track_counters.Finish(state);
+  for (grpc_slice& slice : keys) grpc_slice_unref(slice);
+  for (grpc_slice& slice : values) grpc_slice_unref(slice);
+}
+BENCHMARK(BM_MetadataFromInternedSlicesThreaded)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
 static void BM_MetadataFromInternedKey(benchmark::State& state) {
   TrackCounters track_counters;
   grpc_core::ManagedMemorySlice k("key");
@@ -290,13 +290,14 @@ class ShortWorkFunctorForAdd
 // continuously so the number of workers running changes overtime.
 //
 // In effect this tests how well the threadpool avoids spurious wakeups.
+template <class ThreadPoolType>
 static void BM_SpikyLoad(benchmark::State& state) {
   const int num_threads = state.range(0);
 
   const int kNumSpikes = 1000;
   const int batch_size = 3 * num_threads;
   std::vector<ShortWorkFunctorForAdd> work_vector(batch_size);
-  grpc_core::ThreadPool pool(num_threads);
+  ThreadPoolType pool(num_threads);
   while (state.KeepRunningBatch(kNumSpikes * batch_size)) {
     for (int i = 0; i != kNumSpikes; ++i) {
       BlockingCounter counter(batch_size);
@@ -309,7 +310,73 @@ static void BM_SpikyLoad(benchmark::State& state) {
   }
   state.SetItemsProcessed(state.iterations() * batch_size);
 }
-BENCHMARK(BM_SpikyLoad)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(BM_SpikyLoad, grpc_core::ThreadPool)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16);
+BENCHMARK_TEMPLATE(BM_SpikyLoad, grpc_core::WorkStealingThreadPool)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16);
+
+// A functor (closure) that adds two children into the pool until it reaches
+// the bottom of the tree, where it decrements the counter instead. All closures
+// but the root are added from pool threads, so this measures how well the pool
+// spreads work originating on its own workers.
+class FanOutFunctor : public grpc_experimental_completion_queue_functor {
+ public:
+  FanOutFunctor(grpc_core::ThreadPoolInterface* pool, BlockingCounter* counter,
+                int depth)
+      : pool_(pool), counter_(counter), depth_(depth) {
+    functor_run = &FanOutFunctor::Run;
+    inlineable = false;
+    internal_next = this;
+    internal_success = 0;
+  }
+  static void Run(grpc_experimental_completion_queue_functor* cb, int /*ok*/) {
+    auto* callback = static_cast<FanOutFunctor*>(cb);
+    if (callback->depth_ > 0) {
+      for (int i = 0; i < 2; ++i) {
+        callback->pool_->Add(new FanOutFunctor(
+            callback->pool_, callback->counter_, callback->depth_ - 1));
+      }
+    } else {
+      callback->counter_->DecrementCount();
+    }
+    // Suicides.
+    delete callback;
+  }
+
+ private:
+  grpc_core::ThreadPoolInterface* pool_;
+  BlockingCounter* counter_;
+  int depth_;
+};
+
+template <class ThreadPoolType>
+static void BM_ThreadPoolFanOut(benchmark::State& state) {
+  const int num_threads = state.range(0);
+  constexpr int kDepth = 16;
+  constexpr int kNumClosures = (2 << kDepth) - 1;
+  ThreadPoolType pool(num_threads);
+  while (state.KeepRunningBatch(kNumClosures)) {
+    BlockingCounter counter(1 << kDepth);
+    pool.Add(new FanOutFunctor(&pool, &counter, kDepth));
+    counter.Wait();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+// Argument is the thread pool size (num_threads).
+BENCHMARK_TEMPLATE(BM_ThreadPoolFanOut, grpc_core::ThreadPool)
+    ->RangeMultiplier(2)
+    ->Range(1, 64);
+BENCHMARK_TEMPLATE(BM_ThreadPoolFanOut, grpc_core::WorkStealingThreadPool)
+    ->RangeMultiplier(2)
+    ->Range(1, 64);
 
 }  // namespace testing
 }  // namespace grpc
@@ -25,11 +25,15 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "test/core/util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
 
+extern grpc_timer_vtable grpc_generic_timer_vtable;
+extern grpc_timer_vtable grpc_wheel_timer_vtable;
+
 namespace grpc {
 namespace testing {
 
@@ -100,6 +104,59 @@ BENCHMARK(BM_TimerBatch)
     ->Args({/*check=*/true, /*reverse=*/true})
     ->ThreadRange(1, 128);
 
+// Indexed by the first argument of the benchmarks below.
+static grpc_timer_vtable* const kTimerImpls[] = {&grpc_generic_timer_vtable,
+                                                 &grpc_wheel_timer_vtable};
+
+// Steady-state deadline churn: like RPCs, each iteration cancels one of
+// state.range(1) outstanding timers and re-arms it with a deadline up to a
+// second out. Timers are checked every 64 iterations, so some expire too.
+static void BM_TimerChurn(benchmark::State& state) {
+  grpc_timer_vtable* impl = kTimerImpls[state.range(0)];
+  const size_t outstanding = state.range(1);
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  std::vector<TimerClosure> timer_closures(outstanding);
+  uint32_t rnd = 12345;
+  auto next_deadline = [&rnd]() {
+    rnd = rnd * 1103515245 + 12345;
+    return grpc_core::ExecCtx::Get()->Now() + 1 + (rnd >> 16) % 1000;
+  };
+  for (TimerClosure& timer_closure : timer_closures) {
+    GRPC_CLOSURE_INIT(
+        &timer_closure.closure, [](void* /*args*/, grpc_error* /*err*/) {},
+        nullptr, grpc_schedule_on_exec_ctx);
+    impl->init(&timer_closure.timer, next_deadline(), &timer_closure.closure);
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    TimerClosure* timer_closure = &timer_closures[i++ % outstanding];
+    impl->cancel(&timer_closure->timer);
+    exec_ctx.Flush();
+    impl->init(&timer_closure->timer, next_deadline(), &timer_closure->closure);
+    if (i % 64 == 0) {
+      exec_ctx.InvalidateNow();
+      impl->check(nullptr);
+    }
+    exec_ctx.Flush();
+  }
+  for (TimerClosure& timer_closure : timer_closures) {
+    impl->cancel(&timer_closure.timer);
+  }
+  exec_ctx.Flush();
+  state.SetItemsProcessed(state.iterations());
+  track_counters.Finish(state);
+}
+static void TimerChurnArgs(benchmark::internal::Benchmark* b) {
+  for (int impl = 0; impl < static_cast<int>(GPR_ARRAY_SIZE(kTimerImpls));
+       impl++) {
+    for (int outstanding = 1024; outstanding <= 128 * 1024; outstanding *= 8) {
+      b->Args({impl, outstanding});
+    }
+  }
+}
+BENCHMARK(BM_TimerChurn)->Apply(TimerChurnArgs);
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -111,9 +168,20 @@ void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
 
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
+  // grpc_init() sets up the generic timers; the timing wheel, which
+  // BM_TimerChurn compares them to, is set up here.
+  GPR_GLOBAL_CONFIG_SET(grpc_timer_strategy, "generic");
   LibraryInitializer libInit;
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_wheel_timer_vtable.list_init();
+  }
   ::benchmark::Initialize(&argc, argv);
   ::grpc::testing::InitTest(&argc, &argv, false);
   benchmark::RunTheBenchmarksNamespaced();
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_wheel_timer_vtable.list_shutdown();
+  }
   return 0;
 }
@@ -328,6 +328,30 @@ typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
 typedef MinStackize<InProcessCHTTP2> MinInProcessCHTTP2;
 
+////////////////////////////////////////////////////////////////////////////////
+// TCP receive zerocopy fixtures
+
+class RxZerocopyConfiguration : public FixtureConfiguration {
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    FixtureConfiguration::ApplyCommonChannelArguments(a);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+template <class Base>
+class RxZerocopyize : public Base {
+ public:
+  explicit RxZerocopyize(Service* service)
+      : Base(service, RxZerocopyConfiguration()) {}
+};
+
+typedef RxZerocopyize<TCP> RxZerocopyTCP;
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -59,11 +59,14 @@ static void ApplyCommonChannelArguments(ChannelArguments* c) {
 
 class EndpointPairFixture {
  public:
-  EndpointPairFixture(Service* service, grpc_endpoint_pair endpoints) {
+  EndpointPairFixture(Service* service, grpc_endpoint_pair endpoints,
+                      int write_coalescing_window_us) {
     ServerBuilder b;
     cq_ = b.AddCompletionQueue(true);
     b.RegisterService(service);
     ApplyCommonServerBuilderConfig(&b);
+    b.AddChannelArgument(GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US,
+                         write_coalescing_window_us);
     server_ = b.BuildAndStart();
 
     grpc_core::ExecCtx exec_ctx;
@@ -90,6 +93,8 @@ class EndpointPairFixture {
       ChannelArguments args;
       args.SetString(GRPC_ARG_DEFAULT_AUTHORITY, "test.authority");
       ApplyCommonChannelArguments(&args);
+      args.SetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US,
+                  write_coalescing_window_us);
 
       grpc_channel_args c_args = args.c_channel_args();
       grpc_transport* transport =
@@ -126,8 +131,11 @@ class EndpointPairFixture {
 
 class InProcessCHTTP2 : public EndpointPairFixture {
  public:
-  InProcessCHTTP2(Service* service, grpc_passthru_endpoint_stats* stats)
-      : EndpointPairFixture(service, MakeEndpoints(stats)), stats_(stats) {}
+  InProcessCHTTP2(Service* service, grpc_passthru_endpoint_stats* stats,
+                  int write_coalescing_window_us = 0)
+      : EndpointPairFixture(service, MakeEndpoints(stats),
+                            write_coalescing_window_us),
+        stats_(stats) {}
 
   ~InProcessCHTTP2() override {
     if (stats_ != nullptr) {
@@ -224,6 +232,82 @@ static double UnaryPingPong(int request_size, int response_size) {
   return writes_per_iteration;
 }
 
+// Runs batches of 'concurrency' unary RPCs that are all started before any of
+// them completes.
+static double ConcurrentUnary(int concurrency, int write_coalescing_window_us) {
+  const int kBatches = 200;
+
+  EchoTestService::AsyncService service;
+  std::unique_ptr<InProcessCHTTP2> fixture(
+      new InProcessCHTTP2(&service, grpc_passthru_endpoint_stats_create(),
+                          write_coalescing_window_us));
+  EchoRequest send_request;
+  EchoResponse send_response;
+  send_request.set_message(std::string(16, 'a'));
+  send_response.set_message(std::string(16, 'a'));
+  struct ServerEnv {
+    ServerContext ctx;
+    EchoRequest recv_request;
+    grpc::ServerAsyncResponseWriter<EchoResponse> response_writer;
+    ServerEnv() : response_writer(&ctx) {}
+  };
+  struct ClientEnv {
+    ClientContext ctx;
+    EchoResponse recv_response;
+    Status recv_status;
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader;
+  };
+  // Tags: [0, concurrency) for incoming calls, [concurrency, 2 * concurrency)
+  // for server finishes and [2 * concurrency, 3 * concurrency) for client
+  // finishes.
+  std::vector<std::unique_ptr<ServerEnv>> server_env(concurrency);
+  auto request_echo = [&](int slot) {
+    server_env[slot].reset(new ServerEnv);
+    service.RequestEcho(&server_env[slot]->ctx, &server_env[slot]->recv_request,
+                        &server_env[slot]->response_writer, fixture->cq(),
+                        fixture->cq(), tag(slot));
+  };
+  for (int i = 0; i < concurrency; i++) {
+    request_echo(i);
+  }
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  for (int batch = 0; batch < kBatches; batch++) {
+    std::vector<std::unique_ptr<ClientEnv>> client_env(concurrency);
+    for (int i = 0; i < concurrency; i++) {
+      client_env[i].reset(new ClientEnv);
+      client_env[i]->response_reader =
+          stub->AsyncEcho(&client_env[i]->ctx, send_request, fixture->cq());
+      client_env[i]->response_reader->Finish(&client_env[i]->recv_response,
+                                             &client_env[i]->recv_status,
+                                             tag(2 * concurrency + i));
+    }
+    for (int pending = 3 * concurrency; pending > 0; pending--) {
+      void* t;
+      bool ok;
+      GPR_ASSERT(fixture->cq()->Next(&t, &ok));
+      GPR_ASSERT(ok);
+      int tagnum = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      if (tagnum < concurrency) {
+        server_env[tagnum]->response_writer.Finish(send_response, Status::OK,
+                                                   tag(concurrency + tagnum));
+      } else if (tagnum < 2 * concurrency) {
+        request_echo(tagnum - concurrency);
+      } else {
+        GPR_ASSERT(client_env[tagnum - 2 * concurrency]->recv_status.ok());
+      }
+    }
+  }
+
+  double writes_per_rpc = static_cast<double>(fixture->writes_performed()) /
+                          static_cast<double>(kBatches * concurrency);
+
+  fixture.reset();
+  server_env.clear();
+
+  return writes_per_rpc;
+}
+
 TEST(WritesPerRpcTest, UnaryPingPong) {
   EXPECT_LT(UnaryPingPong(0, 0), 2.05);
   EXPECT_LT(UnaryPingPong(1, 0), 2.05);
@@ -232,6 +316,16 @@ TEST(WritesPerRpcTest, UnaryPingPong) {
   EXPECT_LT(UnaryPingPong(0, 4096), 2.5);
 }
 
+TEST(WritesPerRpcTest, ConcurrentUnaryWithWriteCoalescing) {
+  // Without coalescing, RPCs started from separate API calls mostly get
+  // separate writes. With it, the RPCs of a batch share them.
+  const double uncoalesced = ConcurrentUnary(32, 0);
+  const double coalesced = ConcurrentUnary(32, 2000);
+  gpr_log(GPR_INFO, "writes per RPC: %.3f uncoalesced, %.3f coalesced",
+          uncoalesced, coalesced);
+  EXPECT_LT(coalesced, uncoalesced / 2);
+}
+
 }  // namespace testing
 }  // namespace grpc
 
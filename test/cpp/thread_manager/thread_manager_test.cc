@@ -55,13 +55,21 @@ struct TestThreadManagerSettings {
 
   // How many should be instantiated
   int thread_manager_count;
+
+  // The number of handler threads (0 if pollers should do the work)
+  int num_handler_threads;
+
+  // The bound of the handler pool queue (unbounded if 0)
+  int max_handler_queue_size;
 };
 
 class TestThreadManager final : public grpc::ThreadManager {
  public:
   TestThreadManager(const char* name, grpc_resource_quota* rq,
                     const TestThreadManagerSettings& settings)
-      : ThreadManager(name, rq, settings.min_pollers, settings.max_pollers),
+      : ThreadManager(name, rq, settings.min_pollers, settings.max_pollers,
+                      settings.num_handler_threads,
+                      settings.max_handler_queue_size),
         settings_(settings),
         num_do_work_(0),
         num_poll_for_work_(0),
@@ -149,10 +157,20 @@ class ThreadManagerTest
 TestThreadManagerSettings scenarios[] = {
     {2 /* min_pollers */, 10 /* max_pollers */, 10 /* poll_duration_ms */,
      1 /* work_duration_ms */, 50 /* max_poll_calls */,
-     INT_MAX /* thread_limit */, 1 /* thread_manager_count */},
+     INT_MAX /* thread_limit */, 1 /* thread_manager_count */,
+     0 /* num_handler_threads */, 0 /* max_handler_queue_size */},
     {1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
      10 /* work_duration_ms */, 50 /* max_poll_calls */, 3 /* thread_limit */,
-     2 /* thread_manager_count */}};
+     2 /* thread_manager_count */, 0 /* num_handler_threads */,
+     0 /* max_handler_queue_size */},
+    {2 /* min_pollers */, 2 /* max_pollers */, 1 /* poll_duration_ms */,
+     10 /* work_duration_ms */, 50 /* max_poll_calls */,
+     INT_MAX /* thread_limit */, 1 /* thread_manager_count */,
+     2 /* num_handler_threads */, 1 /* max_handler_queue_size */},
+    {1 /* min_pollers */, 1 /* max_pollers */, 10 /* poll_duration_ms */,
+     1 /* work_duration_ms */, 50 /* max_poll_calls */, 3 /* thread_limit */,
+     1 /* thread_manager_count */, 2 /* num_handler_threads */,
+     0 /* max_handler_queue_size */}};
 
 INSTANTIATE_TEST_SUITE_P(ThreadManagerTest, ThreadManagerTest,
                          ::testing::ValuesIn(scenarios));
@@ -176,6 +194,29 @@ TEST_P(ThreadManagerTest, TestThreadQuota) {
   }
 }
 
+TEST_P(ThreadManagerTest, TestHandlerPool) {
+  if (GetParam().num_handler_threads > 0) {
+    for (auto& tm : thread_manager_) {
+      // All the threads are spawned up front and never replaced
+      EXPECT_EQ(tm->GetMaxActiveThreadsSoFar(),
+                GetParam().min_pollers + GetParam().num_handler_threads);
+      // Every piece of work found is either run by a handler thread or
+      // rejected because the queue was full
+      grpc::ThreadManager::HandlerPoolStats stats = tm->GetHandlerPoolStats();
+      EXPECT_EQ(stats.queue_depth, 0u);
+      EXPECT_EQ(stats.num_dispatched + stats.num_rejected,
+                tm->num_work_found());
+      EXPECT_LE(stats.max_wait_usec, stats.total_wait_usec);
+      if (GetParam().max_handler_queue_size > 0) {
+        EXPECT_LE(stats.max_queue_depth,
+                  static_cast<size_t>(GetParam().max_handler_queue_size));
+      } else {
+        EXPECT_EQ(stats.num_rejected, 0);
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace grpc
 
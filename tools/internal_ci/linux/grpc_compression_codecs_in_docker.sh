@@ -0,0 +1,41 @@
+#!/usr/bin/env bash
+# Copyright 2020 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+set -ex -o igncr || set -ex
+
+mkdir -p /var/local/git
+git clone /var/local/jenkins/grpc /var/local/git/grpc
+(cd /var/local/jenkins/grpc/ && git submodule foreach 'cd /var/local/git/grpc \
+&& git submodule update --init --reference /var/local/jenkins/grpc/${name} \
+${name}')
+cd /var/local/git/grpc
+
+apt-get update && apt-get install -y libzstd-dev liblz4-dev
+
+mkdir -p cmake/build
+cd cmake/build
+cmake -DgRPC_BUILD_TESTS=ON \
+      -DgRPC_ZSTD_PROVIDER=package \
+      -DgRPC_LZ4_PROVIDER=package \
+      ../..
+make -j4 message_compress_test compression_test
+# message_compress_test skips algorithms that were not built in; fail if
+# either codec was skipped, since that means the build wiring is broken.
+GRPC_VERBOSITY=INFO ./message_compress_test 2>&1 | tee message_compress_test.log
+test "${PIPESTATUS[0]}" -eq 0
+if grep -q "not built in" message_compress_test.log; then
+  exit 1
+fi
+./compression_test
@@ -62,6 +62,12 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_pollset_kick_own_thread"] = massage_qps_stats_helpers.counter(
                     core_stats, "pollset_kick_own_thread")
+            stats["core_busy_poll_spins"] = massage_qps_stats_helpers.counter(
+                core_stats, "busy_poll_spins")
+            stats["core_busy_poll_hits"] = massage_qps_stats_helpers.counter(
+                core_stats, "busy_poll_hits")
+            stats["core_busy_poll_sleeps"] = massage_qps_stats_helpers.counter(
+                core_stats, "busy_poll_sleeps")
             stats["core_syscall_epoll_ctl"] = massage_qps_stats_helpers.counter(
                 core_stats, "syscall_epoll_ctl")
             stats[
@@ -119,6 +125,12 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_http2_partial_writes"] = massage_qps_stats_helpers.counter(
                     core_stats, "http2_partial_writes")
+            stats[
+                "core_http2_writes_coalesced"] = massage_qps_stats_helpers.counter(
+                    core_stats, "http2_writes_coalesced")
+            stats[
+                "core_http2_coalesced_writes_cut_short"] = massage_qps_stats_helpers.counter(
+                    core_stats, "http2_coalesced_writes_cut_short")
             stats[
                 "core_http2_initiate_write_due_to_initial_write"] = massage_qps_stats_helpers.counter(
                     core_stats, "http2_initiate_write_due_to_initial_write")
@@ -494,6 +506,21 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_http2_send_flowctl_per_write_99p"] = massage_qps_stats_helpers.percentile(
                     h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(core_stats,
+                                                    "http2_frames_per_write")
+            stats["core_http2_frames_per_write"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_http2_frames_per_write_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_http2_frames_per_write_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_http2_frames_per_write_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_http2_frames_per_write_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
             h = massage_qps_stats_helpers.histogram(core_stats,
                                                     "server_cqs_checked")
             stats["core_server_cqs_checked"] = ",".join(